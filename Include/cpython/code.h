@@ -13,6 +13,7 @@ typedef uint16_t _Py_CODEUNIT;
 #endif
 
 typedef struct _PyOpcache _PyOpcache;
+typedef struct _PyOpcacheStats _PyOpcacheStats;
 
 /* Bytecode object */
 struct PyCodeObject {
@@ -40,6 +41,9 @@ struct PyCodeObject {
     PyObject *co_name;          /* unicode (name, for reference) */
     PyObject *co_linetable;     /* string (encoding addr<->lineno mapping) See
                                    Objects/lnotab_notes.txt for details. */
+    PyObject *co_exceptiontable; /* bytes (instruction ranges covered by
+                                    exception handlers) See
+                                    Objects/exception_handling_notes.txt. */
     void *co_zombieframe;       /* for optimization only (see frameobject.c) */
     PyObject *co_weakreflist;   /* to support weakrefs to code objects */
     /* Scratch space for extra data relating to the code object.
@@ -61,6 +65,12 @@ struct PyCodeObject {
     _PyOpcache *co_opcache;
     int co_opcache_flag;  // used to determine when create a cache.
     unsigned char co_opcache_size;  // length of co_opcache.
+    // Opcode cache counters, allocated when statistics are enabled
+    // by sys._set_opcache_stats().
+    _PyOpcacheStats *co_opcache_stats;
+    // Copy of co_code with superinstructions, created by _PyCode_Quicken()
+    // along with the opcode cache.  Instruction offsets are unchanged.
+    _Py_CODEUNIT *co_quickened;
 };
 
 /* Masks for co_flags above */
@@ -37,6 +37,7 @@ struct _frame {
     int f_stackdepth;           /* Depth of value stack */
     char f_trace_lines;         /* Emit per-line trace events? */
     char f_trace_opcodes;       /* Emit per-opcode trace events? */
+    char f_on_stack;            /* Allocated in tstate->frame_chunk? */
 
     /* Borrowed reference to a generator, or NULL */
     PyObject *f_gen;
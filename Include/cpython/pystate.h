@@ -149,6 +149,10 @@ struct _ts {
 
     CFrame root_cframe;
 
+    /* Memory the frames of deep calls are allocated from, see
+       Objects/frameobject.c */
+    struct _frame_chunk *frame_chunk;
+
     /* XXX signal handlers should also be here */
 
 };
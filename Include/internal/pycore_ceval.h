@@ -63,6 +63,8 @@ extern void _PyEval_FiniGIL(PyInterpreterState *interp);
 extern void _PyEval_ReleaseLock(PyThreadState *tstate);
 
 extern void _PyEval_DeactivateOpCache(void);
+extern void _PyEval_SetOpcacheStats(int enable);
+extern PyObject* _PyEval_GetOpcacheStats(PyCodeObject *co);
 
 
 /* --- _Py_EnterRecursiveCall() ----------------------------------------- */
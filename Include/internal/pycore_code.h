@@ -16,16 +16,108 @@ typedef struct {
     unsigned int tp_version_tag;
 } _PyOpCodeOpt_LoadAttr;
 
+typedef struct {
+    PyTypeObject *type;
+    Py_ssize_t hint;  /* dict index if >= 0, inverted slot offset if < -1 */
+    unsigned int tp_version_tag;
+} _PyOpCodeOpt_StoreAttr;
+
+typedef struct {
+    PyTypeObject *type;  /* list or dict (borrowed, static type) */
+    Py_ssize_t hint;     /* dict index of the last str key found */
+} _PyOpcache_BinarySubscr;
+
+typedef struct {
+    PyTypeObject *type;  /* type of the callable (borrowed, static type) */
+} _PyOpcache_CallFunction;
+
 struct _PyOpcache {
     union {
         _PyOpcache_LoadGlobal lg;
         _PyOpCodeOpt_LoadAttr la;
+        _PyOpCodeOpt_StoreAttr sa;
+        _PyOpcache_BinarySubscr bs;
+        _PyOpcache_CallFunction cf;
     } u;
     char optimized;
 };
 
+/* Opcode cache statistics */
+
+enum {
+    _PyOpcache_STAT_LOAD_GLOBAL,
+    _PyOpcache_STAT_LOAD_ATTR,
+    _PyOpcache_STAT_STORE_ATTR,
+    _PyOpcache_STAT_BINARY_SUBSCR,
+    _PyOpcache_STAT_CALL_FUNCTION,
+    _PyOpcache_STAT_NKINDS
+};
+
+enum {
+    _PyOpcache_STAT_OPTS,    /* cache entry specialized for the first time */
+    _PyOpcache_STAT_HITS,
+    _PyOpcache_STAT_MISSES,
+    _PyOpcache_STAT_DEOPTS,  /* cache entry disabled for good */
+    _PyOpcache_STAT_NEVENTS
+};
+
+struct _PyOpcacheStats {
+    size_t counts[_PyOpcache_STAT_NKINDS][_PyOpcache_STAT_NEVENTS];
+};
+
 /* Private API */
 int _PyCode_InitOpcache(PyCodeObject *co);
+int _PyCode_Quicken(PyCodeObject *co);
+
+/* Like PyCode_NewWithPosOnlyArgs() with an exception table, NULL meaning
+   that no instruction is covered by an exception handler. */
+PyAPI_FUNC(PyCodeObject *) _PyCode_NewWithExceptionTable(
+        int argcount, int posonlyargcount, int kwonlyargcount,
+        int nlocals, int stacksize, int flags,
+        PyObject *code, PyObject *consts, PyObject *names,
+        PyObject *varnames, PyObject *freevars, PyObject *cellvars,
+        PyObject *filename, PyObject *name, int firstlineno,
+        PyObject *linetable, PyObject *exceptiontable);
+
+/* An entry of co_exceptiontable: instructions start to end (exclusive,
+   in code units) are handled by the handler at offset handler, entered
+   with the value stack cut down to level items. */
+typedef struct {
+    int start;
+    int end;
+    int handler;
+    int level;
+} _PyExceptionTableEntry;
+
+/* Read the entry at *pos of the exception table and advance *pos.
+   Return 0 at the end of the table, -1 if it is malformed. */
+int _PyCode_ReadExceptionTableEntry(PyObject *table, Py_ssize_t *pos,
+                                    _PyExceptionTableEntry *entry);
+
+/* Find the innermost handler covering the instruction at offset.
+   Return 1 and fill *entry if there is one, 0 otherwise. */
+int _PyCode_FindExceptionHandler(PyCodeObject *co, int offset,
+                                 _PyExceptionTableEntry *entry);
+
+/* Value of co_zombieframe while the frame that will become the zombie
+   frame of the code object is in use, see Objects/frameobject.c */
+#define _PyCode_ZOMBIE_IN_USE ((void *)1)
+
+/* Lazy code objects: code objects nested in a code object read by
+   marshal.loads() are kept in marshalled form until they are first used
+   (see TYPE_LAZY_CODE in Python/marshal.c).  They only ever appear in
+   co_consts, and the accessors below replace them by real code objects. */
+PyAPI_DATA(PyTypeObject) _PyLazyCode_Type;
+#define _PyLazyCode_Check(op) Py_IS_TYPE(op, &_PyLazyCode_Type)
+
+PyObject *_PyLazyCode_New(PyObject *data, Py_ssize_t offset, Py_ssize_t size);
+/* Return a new reference to the code object, reading it if needed */
+PyObject *_PyLazyCode_Load(PyObject *lazy);
+/* Return a new reference to the code object for the lazy constant of co,
+   replacing it in co->co_consts */
+PyObject *_PyCode_LoadLazyConst(PyCodeObject *co, PyObject *lazy);
+/* Replace all the lazy constants of co by code objects */
+int _PyCode_LoadLazyConsts(PyCodeObject *co);
 
 
 #ifdef __cplusplus
@@ -159,6 +159,22 @@ struct _gc_runtime_state {
        collections, and are awaiting to undergo a full collection for
        the first time. */
     Py_ssize_t long_lived_pending;
+    /* Pause budget of the automatic collections of the oldest generation,
+       in milliseconds, when they are incremental (see gc.set_incremental()).
+       0 if they are full collections. */
+    double incremental_pause;
+    /* Estimated number of objects of the oldest generation examined per
+       millisecond by an incremental collection. */
+    double incremental_rate;
+    /* true if the thresholds are adapted to the amount of garbage the
+       collections find (see gc.set_adaptive()) */
+    int adaptive;
+    /* thresholds set by gc.set_threshold(); generations[i].threshold only
+       differs from them in adaptive mode */
+    int base_thresholds[NUM_GENERATIONS];
+    /* number of threads used to collect large generations (see
+       gc.set_parallel()) */
+    int parallel_threads;
 };
 
 extern void _PyGC_InitState(struct _gc_runtime_state *);
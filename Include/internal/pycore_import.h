@@ -10,6 +10,10 @@ extern PyStatus _PyImport_ReInitLock(void);
 #endif
 extern PyObject* _PyImport_BootstrapImp(PyThreadState *tstate);
 
+/* Standard library modules frozen into the executable (see Python/frozen.c),
+   searched after PyImport_FrozenModules */
+extern const struct _frozen *_PyImport_FrozenStdlibModules;
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,9 @@ typedef struct _PyPathConfig {
     wchar_t *program_name;
     /* Set by Py_SetPythonHome() or PYTHONHOME environment variable */
     wchar_t *home;
+    /* Directory of the standard library (containing os.py), if found by
+       _PyPathConfig_Calculate() */
+    wchar_t *stdlib_dir;
 #ifdef MS_WINDOWS
     /* isolated and site_import are used to set Py_IsolatedFlag and
        Py_NoSiteFlag flags on Windows in read_pth_file(). These fields
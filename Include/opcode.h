@@ -39,6 +39,7 @@ extern "C" {
 #define GET_AITER                50
 #define GET_ANEXT                51
 #define BEFORE_ASYNC_WITH        52
+#define BEFORE_WITH              53
 #define END_ASYNC_FOR            54
 #define INPLACE_ADD              55
 #define INPLACE_SUBTRACT         56
@@ -134,6 +135,15 @@ extern "C" {
 #define SET_UPDATE              163
 #define DICT_MERGE              164
 #define DICT_UPDATE             165
+
+    /* Superinstructions, only found in quickened code */
+#define LOAD_FAST__LOAD_FAST     99
+#define LOAD_FAST__LOAD_CONST   120
+#define LOAD_FAST__LOAD_ATTR    123
+#define LOAD_CONST__LOAD_FAST   127
+#define LOAD_CONST__RETURN_VALUE 128
+#define STORE_FAST__LOAD_FAST   134
+#define STORE_FAST__STORE_FAST  139
 #ifdef NEED_OPCODE_JUMP_TABLES
 static uint32_t _PyOpcode_RelativeJump[8] = {
     0U,
@@ -22,6 +22,10 @@
 
 __all__ = ["compile_dir","compile_file","compile_path"]
 
+# Parallel compilation sends the files to the workers in chunks.
+_CHUNKS_PER_WORKER = 4
+_MAX_CHUNK_FILES = 256
+
 def _walk_dir(dir, maxlevels, quiet=0):
     if quiet < 2 and isinstance(dir, os.PathLike):
         dir = os.fspath(dir)
@@ -45,10 +49,52 @@ def _walk_dir(dir, maxlevels, quiet=0):
             yield from _walk_dir(fullname, maxlevels=maxlevels - 1,
                                  quiet=quiet)
 
+def _chunk_files(files, workers):
+    """Group files into chunks of about the same total size.
+
+    The largest files come first, so that the workers which are done with
+    their chunk pick up the remaining, smaller ones while the others finish.
+    """
+    sized = []
+    total = 0
+    for fullname in files:
+        try:
+            size = os.stat(fullname).st_size
+        except OSError:
+            size = 0
+        sized.append((size, fullname))
+        total += size
+    sized.sort(key=lambda item: item[0], reverse=True)
+    # A few chunks per worker balance the load without paying the overhead
+    # of a task per file.
+    target = total // (workers * _CHUNKS_PER_WORKER) + 1
+    chunks = []
+    chunk = []
+    chunk_size = 0
+    for size, fullname in sized:
+        chunk.append(fullname)
+        chunk_size += size
+        if chunk_size >= target or len(chunk) >= _MAX_CHUNK_FILES:
+            chunks.append(chunk)
+            chunk = []
+            chunk_size = 0
+    if chunk:
+        chunks.append(chunk)
+    return chunks
+
+def _compile_files(files, **kwargs):
+    """Byte-compile a chunk of files in a worker process."""
+    success = True
+    for fullname in files:
+        if not compile_file(fullname, **kwargs):
+            success = False
+    return success
+
 def compile_dir(dir, maxlevels=None, ddir=None, force=False,
                 rx=None, quiet=0, legacy=False, optimize=-1, workers=1,
                 invalidation_mode=None, *, stripdir=None,
-                prependdir=None, limit_sl_dest=None, hardlink_dupes=False):
+                prependdir=None, limit_sl_dest=None, hardlink_dupes=False,
+                lazy=False):
     """Byte-compile all modules in the given directory tree.
 
     Arguments (only dir is required):
@@ -72,6 +118,7 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
     limit_sl_dest: ignore symlinks if they are pointing outside of
                    the defined path
     hardlink_dupes: hardlink duplicated pyc files
+    lazy:      if True, nested code objects are unmarshalled on first use
     """
     ProcessPoolExecutor = None
     if ddir is not None and (stripdir is not None or prependdir is not None):
@@ -99,8 +146,9 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
     if workers != 1 and ProcessPoolExecutor is not None:
         # If workers == 0, let ProcessPoolExecutor choose
         workers = workers or None
+        chunks = _chunk_files(files, workers or os.cpu_count() or 1)
         with ProcessPoolExecutor(max_workers=workers) as executor:
-            results = executor.map(partial(compile_file,
+            results = executor.map(partial(_compile_files,
                                            ddir=ddir, force=force,
                                            rx=rx, quiet=quiet,
                                            legacy=legacy,
@@ -109,8 +157,9 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
                                            stripdir=stripdir,
                                            prependdir=prependdir,
                                            limit_sl_dest=limit_sl_dest,
-                                           hardlink_dupes=hardlink_dupes),
-                                   files)
+                                           hardlink_dupes=hardlink_dupes,
+                                           lazy=lazy),
+                                   chunks)
             success = min(results, default=True)
     else:
         for file in files:
@@ -118,14 +167,33 @@ def compile_dir(dir, maxlevels=None, ddir=None, force=False,
                                 legacy, optimize, invalidation_mode,
                                 stripdir=stripdir, prependdir=prependdir,
                                 limit_sl_dest=limit_sl_dest,
-                                hardlink_dupes=hardlink_dupes):
+                                hardlink_dupes=hardlink_dupes, lazy=lazy):
                 success = False
     return success
 
+def _expected_header(fullname, invalidation_mode):
+    """Return the start of the header of an up-to-date pyc of fullname.
+
+    Hash-based pycs record the hash of their source, so they are up to date
+    even if the source was copied with a new mtime since they were written.
+    """
+    if invalidation_mode is None:
+        invalidation_mode = py_compile._get_default_invalidation_mode()
+    if invalidation_mode == py_compile.PycInvalidationMode.TIMESTAMP:
+        mtime = int(os.stat(fullname).st_mtime)
+        return struct.pack('<4sll', importlib.util.MAGIC_NUMBER, 0, mtime)
+    flags = 0b1
+    if invalidation_mode == py_compile.PycInvalidationMode.CHECKED_HASH:
+        flags |= 0b10
+    with open(fullname, 'rb') as source:
+        source_hash = importlib.util.source_hash(source.read())
+    return (struct.pack('<4sl', importlib.util.MAGIC_NUMBER, flags)
+            + source_hash)
+
 def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
                  legacy=False, optimize=-1,
                  invalidation_mode=None, *, stripdir=None, prependdir=None,
-                 limit_sl_dest=None, hardlink_dupes=False):
+                 limit_sl_dest=None, hardlink_dupes=False, lazy=False):
     """Byte-compile one file.
 
     Arguments (only fullname is required):
@@ -147,6 +215,7 @@ def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
     limit_sl_dest: ignore symlinks if they are pointing outside of
                    the defined path.
     hardlink_dupes: hardlink duplicated pyc files
+    lazy:      if True, nested code objects are unmarshalled on first use
     """
 
     if ddir is not None and (stripdir is not None or prependdir is not None):
@@ -220,12 +289,10 @@ def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
         if tail == '.py':
             if not force:
                 try:
-                    mtime = int(os.stat(fullname).st_mtime)
-                    expect = struct.pack('<4sll', importlib.util.MAGIC_NUMBER,
-                                         0, mtime)
+                    expect = _expected_header(fullname, invalidation_mode)
                     for cfile in opt_cfiles.values():
                         with open(cfile, 'rb') as chandle:
-                            actual = chandle.read(12)
+                            actual = chandle.read(len(expect))
                         if expect != actual:
                             break
                     else:
@@ -239,7 +306,8 @@ def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
                     cfile = opt_cfiles[opt_level]
                     ok = py_compile.compile(fullname, cfile, dfile, True,
                                             optimize=opt_level,
-                                            invalidation_mode=invalidation_mode)
+                                            invalidation_mode=invalidation_mode,
+                                            lazy=lazy)
                     if index > 0 and hardlink_dupes:
                         previous_cfile = opt_cfiles[optimize[index - 1]]
                         if filecmp.cmp(cfile, previous_cfile, shallow=False):
@@ -274,7 +342,7 @@ def compile_file(fullname, ddir=None, force=False, rx=None, quiet=0,
 
 def compile_path(skip_curdir=1, maxlevels=0, force=False, quiet=0,
                  legacy=False, optimize=-1,
-                 invalidation_mode=None):
+                 invalidation_mode=None, *, lazy=False):
     """Byte-compile all module on sys.path.
 
     Arguments (all optional):
@@ -286,6 +354,7 @@ def compile_path(skip_curdir=1, maxlevels=0, force=False, quiet=0,
     legacy: as for compile_dir() (default False)
     optimize: as for compile_dir() (default -1)
     invalidation_mode: as for compiler_dir()
+    lazy: as for compile_dir() (default False)
     """
     success = True
     for dir in sys.path:
@@ -302,6 +371,7 @@ def compile_path(skip_curdir=1, maxlevels=0, force=False, quiet=0,
                 legacy=legacy,
                 optimize=optimize,
                 invalidation_mode=invalidation_mode,
+                lazy=lazy,
             )
     return success
 
@@ -376,6 +446,9 @@ def main():
     parser.add_argument('--hardlink-dupes', action='store_true',
                         dest='hardlink_dupes',
                         help='Hardlink duplicated pyc files')
+    parser.add_argument('--lazy', action='store_true', dest='lazy',
+                        help=('Write nested code objects so that they are '
+                              'only unmarshalled when first used'))
 
     args = parser.parse_args()
     compile_dests = args.compile_dest
@@ -434,7 +507,8 @@ def main():
                                         prependdir=args.prependdir,
                                         optimize=args.opt_levels,
                                         limit_sl_dest=args.limit_sl_dest,
-                                        hardlink_dupes=args.hardlink_dupes):
+                                        hardlink_dupes=args.hardlink_dupes,
+                                        lazy=args.lazy):
                         success = False
                 else:
                     if not compile_dir(dest, maxlevels, args.ddir,
@@ -445,13 +519,15 @@ def main():
                                        prependdir=args.prependdir,
                                        optimize=args.opt_levels,
                                        limit_sl_dest=args.limit_sl_dest,
-                                       hardlink_dupes=args.hardlink_dupes):
+                                       hardlink_dupes=args.hardlink_dupes,
+                                       lazy=args.lazy):
                         success = False
             return success
         else:
             return compile_path(legacy=args.legacy, force=args.force,
                                 quiet=args.quiet,
-                                invalidation_mode=invalidation_mode)
+                                invalidation_mode=invalidation_mode,
+                                lazy=args.lazy)
     except KeyboardInterrupt:
         if args.quiet < 2:
             print("\n[interrupted]")
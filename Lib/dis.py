@@ -278,7 +278,8 @@ def get_instructions(x, *, first_line=None):
         line_offset = 0
     return _get_instructions_bytes(co.co_code, co.co_varnames, co.co_names,
                                    co.co_consts, cell_names, linestarts,
-                                   line_offset)
+                                   line_offset,
+                                   _parse_exception_table(co))
 
 def _get_const_info(const_index, const_list):
     """Helper to get optional details about const references
@@ -308,8 +309,41 @@ def _get_name_info(name_index, name_list):
     return argval, argrepr
 
 
+_ExceptionTableEntry = collections.namedtuple("_ExceptionTableEntry",
+                                              "start end target depth")
+
+def _parse_varint(iterator):
+    b = next(iterator)
+    val = b & 127
+    shift = 0
+    while b & 128:
+        shift += 7
+        b = next(iterator)
+        val |= (b & 127) << shift
+    return val
+
+def _parse_exception_table(code):
+    """Return the entries of the exception table of a code object.
+
+    Offsets are in bytes, like the offsets of instructions, and the end
+    of an entry is exclusive.  See Objects/exception_handling_notes.txt.
+    """
+    iterator = iter(code.co_exceptiontable)
+    entries = []
+    try:
+        while True:
+            start = _parse_varint(iterator)*2
+            length = _parse_varint(iterator)*2
+            target = _parse_varint(iterator)*2
+            depth = _parse_varint(iterator)
+            entries.append(_ExceptionTableEntry(start, start + length,
+                                                target, depth))
+    except StopIteration:
+        return entries
+
 def _get_instructions_bytes(code, varnames=None, names=None, constants=None,
-                      cells=None, linestarts=None, line_offset=0):
+                      cells=None, linestarts=None, line_offset=0,
+                      exception_entries=()):
     """Iterate over the instructions in a bytecode string.
 
     Generates a sequence of Instruction namedtuples giving the details of each
@@ -318,7 +352,9 @@ def _get_instructions_bytes(code, varnames=None, names=None, constants=None,
     arguments.
 
     """
-    labels = findlabels(code)
+    labels = set(findlabels(code))
+    for entry in exception_entries:
+        labels.add(entry.target)
     starts_line = None
     for offset, op, arg in _unpack_opargs(code):
         if linestarts is not None:
@@ -369,8 +405,10 @@ def disassemble(co, lasti=-1, *, file=None):
     """Disassemble a code object."""
     cell_names = co.co_cellvars + co.co_freevars
     linestarts = dict(findlinestarts(co))
+    exception_entries = _parse_exception_table(co)
     _disassemble_bytes(co.co_code, lasti, co.co_varnames, co.co_names,
-                       co.co_consts, cell_names, linestarts, file=file)
+                       co.co_consts, cell_names, linestarts, file=file,
+                       exception_entries=exception_entries)
 
 def _disassemble_recursive(co, *, file=None, depth=None):
     disassemble(co, file=file)
@@ -385,7 +423,7 @@ def _disassemble_recursive(co, *, file=None, depth=None):
 
 def _disassemble_bytes(code, lasti=-1, varnames=None, names=None,
                        constants=None, cells=None, linestarts=None,
-                       *, file=None, line_offset=0):
+                       *, file=None, line_offset=0, exception_entries=()):
     # Omit the line number column entirely if we have no line number info
     show_lineno = bool(linestarts)
     if show_lineno:
@@ -403,7 +441,8 @@ def _disassemble_bytes(code, lasti=-1, varnames=None, names=None,
         offset_width = 4
     for instr in _get_instructions_bytes(code, varnames, names,
                                          constants, cells, linestarts,
-                                         line_offset=line_offset):
+                                         line_offset=line_offset,
+                                         exception_entries=exception_entries):
         new_source_line = (show_lineno and
                            instr.starts_line is not None and
                            instr.offset > 0)
@@ -412,6 +451,12 @@ def _disassemble_bytes(code, lasti=-1, varnames=None, names=None,
         is_current_instr = instr.offset == lasti
         print(instr._disassemble(lineno_width, is_current_instr, offset_width),
               file=file)
+    if exception_entries:
+        print("ExceptionTable:", file=file)
+        for entry in exception_entries:
+            end = entry.end - 2
+            print(f"  {entry.start} to {end} -> {entry.target} [{entry.depth}]",
+                  file=file)
 
 def _disassemble_str(source, **kwargs):
     """Compile the source string, then disassemble the code object."""
@@ -482,13 +527,15 @@ def __init__(self, x, *, first_line=None, current_offset=None):
         self._linestarts = dict(findlinestarts(co))
         self._original_object = x
         self.current_offset = current_offset
+        self.exception_entries = _parse_exception_table(co)
 
     def __iter__(self):
         co = self.codeobj
         return _get_instructions_bytes(co.co_code, co.co_varnames, co.co_names,
                                        co.co_consts, self._cell_names,
                                        self._linestarts,
-                                       line_offset=self._line_offset)
+                                       line_offset=self._line_offset,
+                                       exception_entries=self.exception_entries)
 
     def __repr__(self):
         return "{}({!r})".format(self.__class__.__name__,
@@ -519,7 +566,8 @@ def dis(self):
                                linestarts=self._linestarts,
                                line_offset=self._line_offset,
                                file=output,
-                               lasti=offset)
+                               lasti=offset,
+                               exception_entries=self.exception_entries)
             return output.getvalue()
 
 
@@ -826,10 +826,34 @@ def module_repr(m):
     @classmethod
     def find_spec(cls, fullname, path=None, target=None):
         if _imp.is_frozen(fullname):
-            return spec_from_loader(fullname, cls, origin=cls._ORIGIN)
+            spec = spec_from_loader(fullname, cls, origin=cls._ORIGIN)
+            filename = cls._resolve_filename(
+                fullname, spec.submodule_search_locations is not None)
+            if filename is not None:
+                # A frozen standard library module: the module gets its
+                # original __file__ and __path__ (see exec_module())
+                spec.loader_state = filename
+                if spec.submodule_search_locations is not None:
+                    spec.submodule_search_locations.append(
+                        _bootstrap_external._path_split(filename)[0])
+            return spec
         else:
             return None
 
+    @staticmethod
+    def _resolve_filename(fullname, ispkg):
+        """Return the source file of a frozen standard library module."""
+        stdlib_dir = getattr(sys, '_stdlib_dir', None)
+        if (not stdlib_dir or _bootstrap_external is None
+                or not _imp._is_frozen_stdlib(fullname)):
+            return None
+        parts = fullname.split('.')
+        if ispkg:
+            parts.append('__init__.py')
+        else:
+            parts[-1] += '.py'
+        return _bootstrap_external._path_join(stdlib_dir, *parts)
+
     @classmethod
     def find_module(cls, fullname, path=None):
         """Find a frozen module.
@@ -853,6 +877,10 @@ def exec_module(module):
             raise ImportError('{!r} is not a frozen module'.format(name),
                               name=name)
         code = _call_with_frames_removed(_imp.get_frozen_object, name)
+        filename = module.__spec__.loader_state
+        if isinstance(filename, str):
+            module.__file__ = filename
+            _imp._fix_co_filename(code, filename)
         exec(code, module.__dict__)
 
     @classmethod
@@ -76,6 +76,19 @@ def _relax_case():
 _relax_case = _make_relax_case()
 
 
+if _MS_WINDOWS:
+    _IMPORT_INDEX_KEY = 'PYTHONIMPORTINDEX'
+else:
+    _IMPORT_INDEX_KEY = b'PYTHONIMPORTINDEX'
+
+def _use_import_index():
+    """True if FileFinder should use the on-disk index of its directory."""
+    if 'import_index' in sys._xoptions:
+        return True
+    return (not sys.flags.ignore_environment
+            and bool(_os.environ.get(_IMPORT_INDEX_KEY)))
+
+
 def _pack_uint32(x):
     """Convert a 32-bit integer to little-endian."""
     return (int(x) & 0xFFFFFFFF).to_bytes(4, 'little')
@@ -351,6 +364,8 @@ def _write_atomic(path, data, mode=0o666):
 #     Python 3.10b1 3436 (Add GEN_START bytecode #43683)
 #     Python 3.10b1 3437 (Undo making 'annotations' future by default - We like to dance among core devs!)
 #     Python 3.10b1 3438 Safer line number table handling.
+#     Python 3.10b1 3439 (Add co_exceptiontable and BEFORE_WITH, remove
+#                         the block instructions from co_code)
 
 #
 # MAGIC must change whenever the bytecode emitted by the compiler may no
@@ -360,12 +375,19 @@ def _write_atomic(path, data, mode=0o666):
 # Whenever MAGIC_NUMBER is changed, the ranges in the magic_values array
 # in PC/launcher.c must also be updated.
 
-MAGIC_NUMBER = (3438).to_bytes(2, 'little') + b'\r\n'
+MAGIC_NUMBER = (3439).to_bytes(2, 'little') + b'\r\n'
 _RAW_MAGIC_NUMBER = int.from_bytes(MAGIC_NUMBER, 'little')  # For import.c
 
 _PYCACHE = '__pycache__'
 _OPT = 'opt-'
 
+_INDEX_NAME = '__index__'
+_INDEX_SUFFIX = '.idx'
+# Directories modified more recently than this (in seconds) when their index
+# is written are not indexed: a change made in the same mtime tick as the
+# listing would go unnoticed.
+_INDEX_MIN_AGE = 2.0
+
 SOURCE_SUFFIXES = ['.py']
 if _MS_WINDOWS:
     SOURCE_SUFFIXES.append('.pyw')
@@ -518,6 +540,19 @@ def _get_cached(filename):
         return None
 
 
+def _index_from_path(path):
+    """Given the path to a directory, return the path to its import index.
+
+    The index lives next to the bytecode of the directory's modules, as
+    __pycache__/__index__.{cache_tag}.idx.  NotImplementedError is raised if
+    sys.implementation.cache_tag is None.
+
+    """
+    filename = cache_from_source(_path_join(path, _INDEX_NAME + '.py'),
+                                 optimization='')
+    return filename[:-len(BYTECODE_SUFFIXES[0])] + _INDEX_SUFFIX
+
+
 def _calc_mode(path):
     """Calculate the mode permissions for a bytecode file."""
     try:
@@ -679,24 +714,26 @@ def _compile_bytecode(data, name=None, bytecode_path=None, source_path=None):
                           name=name, path=bytecode_path)
 
 
-def _code_to_timestamp_pyc(code, mtime=0, source_size=0):
+def _code_to_timestamp_pyc(code, mtime=0, source_size=0, *,
+                           marshal_version=marshal.version):
     "Produce the data for a timestamp-based pyc."
     data = bytearray(MAGIC_NUMBER)
     data.extend(_pack_uint32(0))
     data.extend(_pack_uint32(mtime))
     data.extend(_pack_uint32(source_size))
-    data.extend(marshal.dumps(code))
+    data.extend(marshal.dumps(code, marshal_version))
     return data
 
 
-def _code_to_hash_pyc(code, source_hash, checked=True):
+def _code_to_hash_pyc(code, source_hash, checked=True, *,
+                      marshal_version=marshal.version):
     "Produce the data for a hash-based pyc."
     data = bytearray(MAGIC_NUMBER)
     flags = 0b1 | checked << 1
     data.extend(_pack_uint32(flags))
     assert len(source_hash) == 8
     data.extend(source_hash)
-    data.extend(marshal.dumps(code))
+    data.extend(marshal.dumps(code, marshal_version))
     return data
 
 
@@ -1496,10 +1533,17 @@ def __init__(self, path, *loader_details):
         self._path_mtime = -1
         self._path_cache = set()
         self._relaxed_path_cache = set()
+        # Maps module names to (loader index, is package) when the on-disk
+        # import index is used instead of the directory listing.
+        self._index = None
+        self._index_stale = False
 
     def invalidate_caches(self):
         """Invalidate the directory mtime."""
         self._path_mtime = -1
+        # The directory may have changed without changing its mtime: rebuild
+        # the on-disk index rather than trusting it.
+        self._index_stale = True
 
     find_module = _find_module_shim
 
@@ -1528,15 +1572,56 @@ def find_spec(self, fullname, target=None):
 
         Returns the matching spec, or None if not found.
         """
-        is_namespace = False
         tail_module = fullname.rpartition('.')[2]
         try:
             mtime = _path_stat(self.path or _os.getcwd()).st_mtime
         except OSError:
             mtime = -1
         if mtime != self._path_mtime:
-            self._fill_cache()
+            self._index = None
+            if _use_import_index() and not _relax_case():
+                self._fill_index(mtime)
+            else:
+                self._fill_cache()
             self._path_mtime = mtime
+        if self._index is not None:
+            entry = self._index.get(tail_module)
+            if entry is not None and entry[1]:
+                entry = self._check_package(tail_module, entry)
+        else:
+            entry = self._find_entry(tail_module)
+        if entry is None:
+            return None
+        index, is_package = entry
+        base_path = _path_join(self.path, tail_module)
+        if index is None:
+            _bootstrap._verbose_message('possible namespace for {}', base_path)
+            spec = _bootstrap.ModuleSpec(fullname, None)
+            spec.submodule_search_locations = [base_path]
+            return spec
+        suffix, loader_class = self._loaders[index]
+        if is_package:
+            full_path = _path_join(base_path, '__init__' + suffix)
+            return self._get_spec(loader_class, fullname, full_path,
+                                  [base_path], target)
+        full_path = _path_join(self.path, tail_module + suffix)
+        return self._get_spec(loader_class, fullname, full_path, None, target)
+
+    def _find_init(self, base_path):
+        """Return the index of the loader for the __init__ file of the
+        directory base_path, or None if it is not a regular package."""
+        for index, (suffix, loader_class) in enumerate(self._loaders):
+            if _path_isfile(_path_join(base_path, '__init__' + suffix)):
+                return index
+        return None
+
+    def _find_entry(self, tail_module):
+        """Look up a module in the cached directory listing.
+
+        Returns (loader index, is package), with a loader index of None for a
+        possible namespace package, or None if the module is not found.
+        """
+        is_namespace = False
         # tail_module keeps the original casing, for __file__ and friends
         if _relax_case():
             cache = self._relaxed_path_cache
@@ -1547,17 +1632,14 @@ def find_spec(self, fullname, target=None):
         # Check if the module is the name of a directory (and thus a package).
         if cache_module in cache:
             base_path = _path_join(self.path, tail_module)
-            for suffix, loader_class in self._loaders:
-                init_filename = '__init__' + suffix
-                full_path = _path_join(base_path, init_filename)
-                if _path_isfile(full_path):
-                    return self._get_spec(loader_class, fullname, full_path, [base_path], target)
-            else:
-                # If a namespace package, return the path if we don't
-                #  find a module in the next section.
-                is_namespace = _path_isdir(base_path)
+            index = self._find_init(base_path)
+            if index is not None:
+                return index, True
+            # If a namespace package, return the path if we don't
+            #  find a module in the next section.
+            is_namespace = _path_isdir(base_path)
         # Check for a file w/ a proper suffix exists.
-        for suffix, loader_class in self._loaders:
+        for index, (suffix, loader_class) in enumerate(self._loaders):
             try:
                 full_path = _path_join(self.path, tail_module + suffix)
             except ValueError:
@@ -1565,13 +1647,9 @@ def find_spec(self, fullname, target=None):
             _bootstrap._verbose_message('trying {}', full_path, verbosity=2)
             if cache_module + suffix in cache:
                 if _path_isfile(full_path):
-                    return self._get_spec(loader_class, fullname, full_path,
-                                          None, target)
+                    return index, False
         if is_namespace:
-            _bootstrap._verbose_message('possible namespace for {}', base_path)
-            spec = _bootstrap.ModuleSpec(fullname, None)
-            spec.submodule_search_locations = [base_path]
-            return spec
+            return None, True
         return None
 
     def _fill_cache(self):
@@ -1605,6 +1683,134 @@ def _fill_cache(self):
         if sys.platform.startswith(_CASE_INSENSITIVE_PLATFORMS):
             self._relaxed_path_cache = {fn.lower() for fn in contents}
 
+    def _check_package(self, tail_module, entry):
+        """Check a package entry of the on-disk index.
+
+        Adding or removing the __init__ file of a package does not change the
+        mtime of the directory the index is checked against.
+        """
+        index, is_package = entry
+        base_path = _path_join(self.path, tail_module)
+        if index is not None:
+            init_path = _path_join(base_path, '__init__' + self._loaders[index][0])
+            if _path_isfile(init_path):
+                return entry
+        init_index = self._find_init(base_path)
+        if init_index is not None:
+            return init_index, True
+        if index is None:
+            return entry
+        # The package lost its __init__ file: it could now be shadowed by a
+        # module, which only the directory listing can tell.
+        self._index = None
+        self._index_stale = True
+        self._fill_cache()
+        return self._find_entry(tail_module)
+
+    def _fill_index(self, mtime):
+        """Fill the cache from the on-disk import index of the directory,
+        rebuilding the index if it is missing or out of date."""
+        suffixes = tuple(suffix for suffix, loader in self._loaders)
+        try:
+            index_path = _index_from_path(self.path)
+        except NotImplementedError:
+            index_path = None
+        if index_path is not None and not self._index_stale:
+            try:
+                with _io.FileIO(index_path, 'r') as file:
+                    data = file.read()
+                magic, index_mtime, index_suffixes, index = marshal.loads(data)
+            except (OSError, EOFError, ValueError, TypeError):
+                pass
+            else:
+                if (magic == MAGIC_NUMBER and index_mtime == mtime
+                        and index_suffixes == suffixes):
+                    _bootstrap._verbose_message('{} matches {}', index_path,
+                                                self.path)
+                    self._index = index
+                    return
+        index = self._build_index()
+        if index is None:
+            self._fill_cache()
+            return
+        self._index = index
+        self._index_stale = False
+        if index_path is not None and mtime != -1 and not sys.dont_write_bytecode:
+            data = marshal.dumps((MAGIC_NUMBER, mtime, suffixes, index))
+            self._write_index(index_path, data, mtime)
+
+    def _build_index(self):
+        """Build the import index of the directory from a scan of its
+        contents; return None if the directory could not be scanned."""
+        path = self.path
+        dirs = []
+        files = []
+        try:
+            with _os.scandir(path or _os.getcwd()) as it:
+                for entry in it:
+                    if entry.is_dir():
+                        dirs.append(entry.name)
+                    elif entry.is_file():
+                        files.append(entry.name)
+        except (FileNotFoundError, PermissionError, NotADirectoryError):
+            return {}
+        except OSError:
+            return None
+        if sys.platform.startswith('win'):
+            # See _fill_cache().
+            for i, item in enumerate(files):
+                name, dot, suffix = item.partition('.')
+                if dot:
+                    files[i] = '{}.{}'.format(name, suffix.lower())
+        # Share the entries, so that marshal stores each of them only once.
+        modules = [(i, False) for i in range(len(self._loaders))]
+        packages = [(i, True) for i in range(len(self._loaders))]
+        # Packages first, then modules in the order of the loaders, then
+        # namespace packages: the order find_spec() looks for them in.
+        index = {}
+        namespaces = []
+        for name in dirs:
+            init_index = self._find_init(_path_join(path, name))
+            if init_index is not None:
+                index[name] = packages[init_index]
+            else:
+                namespaces.append(name)
+        for item in files:
+            for i, (suffix, loader) in enumerate(self._loaders):
+                if item.endswith(suffix):
+                    name = item[:-len(suffix)]
+                    entry = index.get(name)
+                    if entry is None or not entry[1] and entry[0] > i:
+                        index[name] = modules[i]
+        namespace = None, True
+        for name in namespaces:
+            index.setdefault(name, namespace)
+        return index
+
+    def _write_index(self, index_path, data, mtime):
+        """Best-effort write of the on-disk import index."""
+        parent = _path_split(index_path)[0]
+        try:
+            _os.mkdir(parent)
+        except FileExistsError:
+            pass
+        except OSError as exc:
+            _bootstrap._verbose_message('could not create {!r}: {!r}',
+                                        parent, exc)
+            return
+        try:
+            _write_atomic(index_path, data)
+            if _path_stat(index_path).st_mtime - mtime < _INDEX_MIN_AGE:
+                _os.unlink(index_path)
+                _bootstrap._verbose_message('{} changed too recently to be '
+                                            'indexed', self.path)
+                return
+        except OSError as exc:
+            _bootstrap._verbose_message('could not create {!r}: {!r}',
+                                        index_path, exc)
+            return
+        _bootstrap._verbose_message('created {!r}', index_path)
+
     @classmethod
     def path_hook(cls, *loader_details):
         """A class method which returns a closure to use on sys.path_hook
@@ -91,6 +91,7 @@ def jabs_op(name, op):
 def_op('GET_AITER', 50)
 def_op('GET_ANEXT', 51)
 def_op('BEFORE_ASYNC_WITH', 52)
+def_op('BEFORE_WITH', 53)
 
 def_op('END_ASYNC_FOR', 54)
 def_op('INPLACE_ADD', 55)
@@ -124,7 +125,7 @@ def jabs_op(name, op):
 def_op('IMPORT_STAR', 84)
 def_op('SETUP_ANNOTATIONS', 85)
 def_op('YIELD_VALUE', 86)
-def_op('POP_BLOCK', 87)
+def_op('POP_BLOCK', 87)       # Compiler only, see SETUP_FINALLY
 
 def_op('POP_EXCEPT', 89)
 
@@ -164,6 +165,9 @@ def jabs_op(name, op):
 def_op('RERAISE', 119)
 
 jabs_op('JUMP_IF_NOT_EXC_MATCH', 121)
+# The block instructions SETUP_FINALLY, SETUP_WITH, SETUP_ASYNC_WITH and
+# POP_BLOCK are only used by the compiler to describe the exception table,
+# and never appear in co_code.
 jrel_op('SETUP_FINALLY', 122)   # Distance to target address
 
 def_op('LOAD_FAST', 124)        # Local variable number
@@ -214,3 +218,17 @@ def jabs_op(name, op):
 def_op('DICT_UPDATE', 165)
 
 del def_op, name_op, jrel_op, jabs_op
+
+# Superinstructions are never emitted by the compiler: the interpreter writes
+# them into the quickened copy of hot code objects in place of the first
+# instruction of a common pair.  Tools/scripts/generate_opcode_h.py assigns
+# them the unused opcodes following HAVE_ARGUMENT; they are not in opmap.
+_superinstructions = [
+    'LOAD_FAST__LOAD_FAST',
+    'LOAD_FAST__LOAD_CONST',
+    'LOAD_FAST__LOAD_ATTR',
+    'LOAD_CONST__LOAD_FAST',
+    'LOAD_CONST__RETURN_VALUE',
+    'STORE_FAST__LOAD_FAST',
+    'STORE_FAST__STORE_FAST',
+]
@@ -7,6 +7,7 @@
 import importlib._bootstrap_external
 import importlib.machinery
 import importlib.util
+import marshal
 import os
 import os.path
 import sys
@@ -77,7 +78,7 @@ def _get_default_invalidation_mode():
 
 
 def compile(file, cfile=None, dfile=None, doraise=False, optimize=-1,
-            invalidation_mode=None, quiet=0):
+            invalidation_mode=None, quiet=0, lazy=False):
     """Byte-compile one Python source file to Python bytecode.
 
     :param file: The source file name.
@@ -97,6 +98,8 @@ def compile(file, cfile=None, dfile=None, doraise=False, optimize=-1,
     :param invalidation_mode:
     :param quiet: Return full output with False or 0, errors only with 1,
         and no output with 2.
+    :param lazy: Write the nested code objects (function and class bodies)
+        so that they are only unmarshalled when first used.
 
     :return: Path to the resulting byte compiled file.
 
@@ -157,16 +160,19 @@ def compile(file, cfile=None, dfile=None, doraise=False, optimize=-1,
             os.makedirs(dirname)
     except FileExistsError:
         pass
+    marshal_version = 5 if lazy else marshal.version
     if invalidation_mode == PycInvalidationMode.TIMESTAMP:
         source_stats = loader.path_stats(file)
         bytecode = importlib._bootstrap_external._code_to_timestamp_pyc(
-            code, source_stats['mtime'], source_stats['size'])
+            code, source_stats['mtime'], source_stats['size'],
+            marshal_version=marshal_version)
     else:
         source_hash = importlib.util.source_hash(source_bytes)
         bytecode = importlib._bootstrap_external._code_to_hash_pyc(
             code,
             source_hash,
             (invalidation_mode == PycInvalidationMode.CHECKED_HASH),
+            marshal_version=marshal_version,
         )
     mode = importlib._bootstrap_external._calc_mode(file)
     importlib._bootstrap_external._write_atomic(cfile, bytecode, mode)
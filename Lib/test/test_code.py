@@ -259,6 +259,7 @@ def func2():
             ("co_filename", "newfilename"),
             ("co_name", "newname"),
             ("co_linetable", code2.co_linetable),
+            ("co_exceptiontable", b'\x00\x02\x04\x00'),
         ):
             with self.subTest(attr=attr, value=value):
                 new_code = code.replace(**{attr: value})
@@ -5,6 +5,7 @@
 import sys
 import _ast
 import tempfile
+import textwrap
 import types
 from test import support
 from test.support import script_helper
@@ -933,6 +934,61 @@ def if_else_break():
             elif instr.opname in HANDLED_JUMPS:
                 self.assertNotEqual(instr.arg, (line + 1)*INSTR_SIZE)
 
+    def test_inline_comprehensions(self):
+        # List, set and dict comprehensions in a function are compiled into
+        # the function itself unless they contain a nested scope, are
+        # asynchronous or are generator expressions.
+        def nested_code(source):
+            ns = {}
+            exec(textwrap.dedent(source), ns)
+            return [const.co_name for const in ns['f'].__code__.co_consts
+                    if isinstance(const, types.CodeType)]
+
+        self.assertEqual(nested_code("""
+            def f(a):
+                return [x for x in a], {x for x in a}, {x: 1 for x in a}
+            """), [])
+        self.assertEqual(nested_code("""
+            def f(a):
+                return [[y for y in x] for x in a]
+            """), ['<listcomp>'])
+        self.assertEqual(nested_code("""
+            def f(a):
+                return [lambda: x for x in a]
+            """), ['<listcomp>'])
+        self.assertEqual(nested_code("""
+            def f(a):
+                return list(x for x in a)
+            """), ['<genexpr>'])
+        self.assertEqual(nested_code("""
+            async def f(a):
+                return [x async for x in a]
+            """), ['<listcomp>'])
+
+    def test_exception_table(self):
+        # Exception handlers are recorded in co_exceptiontable, the block
+        # instructions that delimit them don't appear in the bytecode.
+        def f(a):
+            try:
+                a()
+            except ValueError:
+                return 1
+            with a:
+                pass
+            for x in a:
+                try:
+                    continue
+                finally:
+                    a()
+            return 2
+
+        block_ops = {dis.opmap[name] for name in (
+            'SETUP_FINALLY', 'SETUP_WITH', 'SETUP_ASYNC_WITH', 'POP_BLOCK')}
+        for instr in dis.get_instructions(f):
+            self.assertNotIn(instr.opcode, block_ops)
+        self.assertNotEqual(f.__code__.co_exceptiontable, b'')
+        self.assertEqual(compile('x = 1', '', 'exec').co_exceptiontable, b'')
+
 
 class TestExpressionStackSize(unittest.TestCase):
     # These tests check that the computed stack size for a code object
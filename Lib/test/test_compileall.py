@@ -4,6 +4,7 @@
 import importlib.util
 import io
 import itertools
+import marshal
 import os
 import pathlib
 import py_compile
@@ -198,6 +199,65 @@ def test_compile_pool_called(self, pool_mock):
         compileall.compile_dir(self.directory, quiet=True, workers=5)
         self.assertTrue(pool_mock.called)
 
+    def test_chunk_files(self):
+        sizes = [1000, 10, 400, 600, 5, 300, 200, 0, 100]
+        files = []
+        for i, size in enumerate(sizes):
+            fn = os.path.join(self.directory, 'f{}.py'.format(i))
+            with open(fn, 'wb') as file:
+                file.write(b'#' * size)
+            files.append(fn)
+        missing = os.path.join(self.directory, 'missing.py')
+        chunks = compileall._chunk_files(files + [missing], 2)
+        # Every file is in exactly one chunk, largest files first
+        flat = [fn for chunk in chunks for fn in chunk]
+        self.assertCountEqual(flat, files + [missing])
+        flat_sizes = [os.path.getsize(fn) if fn != missing else 0
+                      for fn in flat]
+        self.assertEqual(flat_sizes, sorted(flat_sizes, reverse=True))
+        self.assertEqual(chunks[0], [files[0]])
+        self.assertGreater(len(chunks), 2)
+        self.assertEqual(compileall._chunk_files([], 2), [])
+
+    @skipUnless(_have_multiprocessing, "requires multiprocessing")
+    def test_compile_workers_chunked(self):
+        self.add_bad_source_file()
+        self.assertFalse(compileall.compile_dir(self.directory, quiet=2,
+                                                workers=2))
+        for bc_path in (self.bc_path, self.bc_path2,
+                        importlib.util.cache_from_source(self.source_path3)):
+            self.assertTrue(os.path.isfile(bc_path))
+
+    def test_hash_based_up_to_date(self):
+        for mode in (py_compile.PycInvalidationMode.CHECKED_HASH,
+                     py_compile.PycInvalidationMode.UNCHECKED_HASH):
+            with self.subTest(mode=mode):
+                compileall.compile_file(self.source_path, quiet=True,
+                                        invalidation_mode=mode, force=True)
+                # A new mtime with the same contents keeps the pyc
+                os.utime(self.source_path, (1, 1))
+                with mock.patch('py_compile.compile') as compile_mock:
+                    self.assertTrue(compileall.compile_file(
+                        self.source_path, quiet=True, invalidation_mode=mode))
+                self.assertFalse(compile_mock.called)
+                # New contents don't
+                with open(self.source_path, 'a', encoding='utf-8') as file:
+                    file.write('y = 1\n')
+                with mock.patch('py_compile.compile') as compile_mock:
+                    compileall.compile_file(self.source_path, quiet=True,
+                                            invalidation_mode=mode)
+                self.assertTrue(compile_mock.called)
+
+    def test_hash_based_other_mode(self):
+        compileall.compile_file(
+            self.source_path, quiet=True,
+            invalidation_mode=py_compile.PycInvalidationMode.CHECKED_HASH)
+        compileall.compile_file(
+            self.source_path, quiet=True,
+            invalidation_mode=py_compile.PycInvalidationMode.UNCHECKED_HASH)
+        with open(self.bc_path, 'rb') as file:
+            self.assertEqual(int.from_bytes(file.read(8)[4:], 'little'), 0b01)
+
     def test_compile_workers_non_positive(self):
         with self.assertRaisesRegex(ValueError,
                                     "workers must be greater or equal to 0"):
@@ -764,6 +824,22 @@ def test_pyc_invalidation_mode(self):
             data = fp.read()
         self.assertEqual(int.from_bytes(data[4:8], 'little'), 0b01)
 
+    def test_lazy(self):
+        script_helper.make_script(self.pkgdir, 'f1', 'def f(): pass')
+        pyc = importlib.util.cache_from_source(
+            os.path.join(self.pkgdir, 'f1.py'))
+        self.assertRunOK(self.pkgdir)
+        size = os.path.getsize(pyc)
+        self.assertRunOK('-f', '--lazy', self.pkgdir)
+        # The nested code object is written as a separate marshal stream,
+        # which cannot share objects with the module code object
+        self.assertGreater(os.path.getsize(pyc), size)
+        with open(pyc, 'rb') as fp:
+            code = marshal.loads(fp.read()[16:])
+        ns = {}
+        exec(code, ns)
+        self.assertIsNone(ns['f']())
+
     @skipUnless(_have_multiprocessing, "requires multiprocessing")
     def test_workers(self):
         bar2fn = script_helper.make_script(self.directory, 'bar2', '')
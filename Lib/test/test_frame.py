@@ -1,5 +1,6 @@
 import re
 import sys
+import threading
 import types
 import unittest
 import weakref
@@ -183,6 +184,46 @@ def test_f_lineno_del_segfault(self):
             del f.f_lineno
 
 
+class DeepRecursionTest(unittest.TestCase):
+    # Frames of deep recursion are allocated from a per-thread stack
+
+    def recurse(self, n, frames):
+        x = [n]
+        if n:
+            frames.append(sys._getframe())
+            self.recurse(n - 1, frames)
+
+    def check_frames(self, frames):
+        for f in frames:
+            self.assertEqual(f.f_code.co_name, 'recurse')
+            self.assertEqual(f.f_locals['x'], [f.f_locals['n']])
+
+    def test_escaped_frames(self):
+        frames = []
+        self.recurse(500, frames)
+        self.check_frames(frames)
+        # Free the frames out of order, then recurse above the survivors
+        survivors = frames[::3]
+        del frames[::7]
+        del frames
+        more = []
+        self.recurse(500, more)
+        self.check_frames(survivors)
+        self.check_frames(more)
+        del survivors
+        self.check_frames(more)
+
+    def test_frames_outlive_thread(self):
+        frames = []
+        t = threading.Thread(target=self.recurse, args=(500, frames))
+        t.start()
+        t.join()
+        self.check_frames(frames)
+        del frames[:250]
+        self.check_frames(frames)
+        del frames
+
+
 class ReprTest(unittest.TestCase):
     """
     Tests for repr(frame).
@@ -761,10 +761,13 @@ def test_get_stats(self):
         for st in stats:
             self.assertIsInstance(st, dict)
             self.assertEqual(set(st),
-                             {"collected", "collections", "uncollectable"})
+                             {"collected", "collections", "uncollectable",
+                              "threshold"})
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
+        self.assertEqual(tuple(st["threshold"] for st in stats),
+                         gc.get_threshold())
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -787,6 +790,145 @@ def test_freeze(self):
         gc.unfreeze()
         self.assertEqual(gc.get_freeze_count(), 0)
 
+    def test_incremental(self):
+        self.assertEqual(gc.get_incremental(), 0.0)
+        self.addCleanup(gc.set_incremental, 0.0)
+        gc.set_incremental(max_pause_ms=2.5)
+        self.assertEqual(gc.get_incremental(), 2.5)
+        self.assertRaises(ValueError, gc.set_incremental, -1.0)
+        self.assertRaises(ValueError, gc.set_incremental, float('nan'))
+        self.assertEqual(gc.get_incremental(), 2.5)
+        gc.set_incremental(0)
+        self.assertEqual(gc.get_incremental(), 0.0)
+
+    def test_incremental_collection(self):
+        # Each automatic collection of the oldest generation only examines a
+        # part of it, but they end up freeing all the cycles it contains.
+        code = """if 1:
+            import gc
+            import weakref
+
+            class A:
+                pass
+
+            gc.disable()
+            gc.collect()
+            filler = [[] for i in range(20000)]
+            cycles = []
+            for i in range(100):
+                a = A()
+                a.cycle = [a]
+                cycles.append(a)
+            refs = [weakref.ref(a) for a in cycles]
+            del a
+            # Move the cycles to the oldest generation
+            gc.collect(1)
+            del cycles
+            assert all(ref() is not None for ref in refs)
+
+            gc.set_incremental(0.001)
+            gc.set_threshold(10, 1, 1)
+            gc.enable()
+            full = gc.get_stats()[2]["collections"]
+            increments = 0
+            keep = []
+            while any(ref() is not None for ref in refs):
+                keep.append([])
+                collections = gc.get_stats()[2]["collections"]
+                if collections != full:
+                    increments += collections - full
+                    full = collections
+                assert increments < 1000
+            print(increments)
+            """
+        rc, out, err = assert_python_ok("-c", code)
+        self.assertEqual(err, b"")
+        # The cycles were appended to the oldest generation after the filler
+        # objects, which don't fit in a single increment.
+        self.assertGreater(int(out), 1)
+
+    def test_adaptive(self):
+        def thresholds():
+            return [st["threshold"] for st in gc.get_stats()]
+
+        if gc.isenabled():
+            self.addCleanup(gc.enable)
+            gc.disable()
+        self.addCleanup(gc.set_threshold, *gc.get_threshold())
+        self.addCleanup(gc.set_adaptive, False)
+        self.assertFalse(gc.get_adaptive())
+        gc.set_threshold(100, 10, 10)
+        gc.set_adaptive(True)
+        self.assertTrue(gc.get_adaptive())
+
+        # Collections finding no garbage raise the threshold...
+        keep = []
+        for i in range(3):
+            keep.append([[] for j in range(100)])
+            gc.collect(0)
+        self.assertEqual(thresholds(), [800, 10, 10])
+        for i in range(10):
+            keep.append([[] for j in range(100)])
+            gc.collect(0)
+        self.assertEqual(thresholds(), [6400, 10, 10])
+        self.assertEqual(gc.get_threshold(), (100, 10, 10))
+
+        # ...and collections finding a lot of it lower it back
+        for i in range(2):
+            for j in range(100):
+                l = []
+                l.append(l)
+            del l
+            gc.collect(0)
+        self.assertEqual(thresholds(), [1600, 10, 10])
+
+        gc.set_threshold(200)
+        self.assertEqual(thresholds(), [200, 10, 10])
+        for i in range(2):
+            keep.append([[] for j in range(100)])
+            gc.collect(0)
+        self.assertEqual(thresholds(), [800, 10, 10])
+        gc.set_adaptive(False)
+        self.assertEqual(thresholds(), [200, 10, 10])
+
+    def test_parallel(self):
+        self.assertEqual(gc.get_parallel(), 1)
+        self.assertRaises(ValueError, gc.set_parallel, 0)
+        try:
+            gc.set_parallel(4)
+        except NotImplementedError:
+            self.skipTest("parallel collection is not supported")
+        self.addCleanup(gc.set_parallel, 1)
+        self.assertEqual(gc.get_parallel(), 4)
+
+        # Large enough to be split between the threads
+        class A:
+            pass
+        def make_garbage(keep):
+            for i in range(50000):
+                a = A()
+                a.cycle = [a]
+                keep.append(a)
+                b = A()
+                b.cycle = (b, [i])
+            # Garbage referring to live objects
+            a = A()
+            a.cycle = [a, keep[0]]
+
+        gc.collect()
+        gc.set_parallel(1)
+        keep = []
+        make_garbage(keep)
+        expected = gc.collect()
+        self.assertGreaterEqual(expected, 50000 * 3)
+        del keep
+        gc.collect()
+        gc.set_parallel(4)
+        keep = []
+        make_garbage(keep)
+        self.assertEqual(gc.collect(), expected)
+        self.assertTrue(all(a.cycle[0] is a for a in keep))
+
     def test_get_objects(self):
         gc.collect()
         l = []
@@ -216,7 +216,8 @@ def test_load_from_source(self):
         orig_path = os.path
         orig_getenv = os.getenv
         with os_helper.EnvironmentVarGuard():
-            x = imp.find_module("os")
+            # os may be frozen: look it up in the stdlib directory
+            x = imp.find_module("os", [os.path.dirname(os.__file__)])
             self.addCleanup(x[0].close)
             new_os = imp.load_module("os", *x)
             self.assertIs(os, new_os)
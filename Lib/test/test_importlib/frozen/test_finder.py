@@ -3,8 +3,17 @@
 
 machinery = util.import_importlib('importlib.machinery')
 
+import _imp
+import os.path
+import sys
 import unittest
 import warnings
+from test.support import script_helper
+
+
+requires_frozen_stdlib = unittest.skipUnless(
+    _imp._is_frozen_stdlib('os') and sys._stdlib_dir is not None,
+    'requires Python configured --with-frozen-stdlib')
 
 
 class FindSpecTests(abc.FinderTests):
@@ -38,6 +47,38 @@ def test_failure(self):
         spec = self.find('<not real>')
         self.assertIsNone(spec)
 
+    def test_not_stdlib(self):
+        spec = self.find('__hello__')
+        self.assertIsNone(spec.loader_state)
+        self.assertFalse(_imp._is_frozen_stdlib('__hello__'))
+
+    @requires_frozen_stdlib
+    def test_stdlib_module(self):
+        spec = self.find('os')
+        self.assertEqual(spec.origin, 'frozen')
+        self.assertEqual(spec.loader_state,
+                         os.path.join(sys._stdlib_dir, 'os.py'))
+        self.assertIsNone(spec.submodule_search_locations)
+
+    @requires_frozen_stdlib
+    def test_stdlib_package(self):
+        spec = self.find('encodings')
+        pkgdir = os.path.join(sys._stdlib_dir, 'encodings')
+        self.assertEqual(spec.loader_state,
+                         os.path.join(pkgdir, '__init__.py'))
+        self.assertEqual(spec.submodule_search_locations, [pkgdir])
+        self.assertIsNone(self.find('encodings.latin_1'))
+
+    @requires_frozen_stdlib
+    def test_stdlib_disabled(self):
+        code = 'import os; print(os.__spec__.origin)'
+        out = script_helper.assert_python_ok('-c', code)[1]
+        self.assertEqual(out.strip(), b'frozen')
+        out = script_helper.assert_python_ok('-X', 'frozen_modules=off',
+                                             '-c', code)[1]
+        self.assertEqual(os.fsdecode(out.strip()),
+                         os.path.join(sys._stdlib_dir, 'os.py'))
+
 
 (Frozen_FindSpecTests,
  Source_FindSpecTests
@@ -4,6 +4,9 @@
 machinery = util.import_importlib('importlib.machinery')
 
 from test.support import captured_stdout
+import _imp
+import os.path
+import sys
 import types
 import unittest
 import warnings
@@ -46,6 +49,19 @@ def test_package(self):
                                  expected=value))
         self.assertEqual(output, 'Hello world!\n')
 
+    @unittest.skipUnless(_imp._is_frozen_stdlib('genericpath'),
+                         'requires Python configured --with-frozen-stdlib')
+    def test_stdlib_module(self):
+        name = 'genericpath'
+        with util.uncache(name):
+            spec = self.machinery.FrozenImporter.find_spec(name)
+            module = types.ModuleType(name)
+            module.__spec__ = spec
+            self.machinery.FrozenImporter.exec_module(module)
+        filename = os.path.join(sys._stdlib_dir, 'genericpath.py')
+        self.assertEqual(module.__file__, filename)
+        self.assertEqual(module.exists.__code__.co_filename, filename)
+
     def test_lacking_parent(self):
         name = '__phello__.spam'
         with util.uncache('__phello__'):
@@ -9,6 +9,7 @@
 import stat
 import sys
 import tempfile
+from test.support import swap_item
 from test.support.import_helper import make_legacy_pyc
 import unittest
 import warnings
@@ -212,6 +213,99 @@ def _find(self, finder, name, loader_only=False):
             return loader_portions[0] if loader_only else loader_portions
 
 
+class IndexFinderTests(FinderTestsPEP451):
+
+    """Run the finder tests with the on-disk import index enabled."""
+
+    def setUp(self):
+        context = swap_item(sys._xoptions, 'import_index', True)
+        context.__enter__()
+        self.addCleanup(context.__exit__, None, None, None)
+        context = swap_item(sys.__dict__, 'dont_write_bytecode', False)
+        context.__enter__()
+        self.addCleanup(context.__exit__, None, None, None)
+
+    def create_indexed(self, *names):
+        """Create the modules and an up-to-date index of their directory."""
+        context = util.create_modules(*names)
+        mapping = context.__enter__()
+        self.addCleanup(context.__exit__, None, None, None)
+        root = mapping['.root']
+        os.mkdir(os.path.join(root, '__pycache__'))
+        # Directories modified within the last seconds are not indexed.
+        os.utime(root, (0, 0))
+        name = names[0].partition('.')[0]
+        self.assertIsNotNone(self.get_finder(root).find_spec(name))
+        self.assertTrue(os.path.exists(self.index_path(root)))
+        return mapping
+
+    def index_path(self, root):
+        cache_tag = sys.implementation.cache_tag
+        return os.path.join(root, '__pycache__',
+                            '__index__.{}.idx'.format(cache_tag))
+
+    def test_index_used(self):
+        mapping = self.create_indexed('mod')
+        root = mapping['.root']
+        with open(os.path.join(root, 'new.py'), 'w', encoding='utf-8'):
+            pass
+        os.utime(root, (0, 0))
+        # The index cannot tell the directory changed.
+        finder = self.get_finder(root)
+        self.assertIsNotNone(self._find(finder, 'mod'))
+        self.assertIsNone(self._find(finder, 'new'))
+        # ... but invalidate_caches() rebuilds it.
+        finder.invalidate_caches()
+        self.assertIsNotNone(self._find(finder, 'new'))
+        self.assertIsNotNone(self._find(self.get_finder(root), 'new'))
+
+    def test_index_mtime(self):
+        mapping = self.create_indexed('mod')
+        root = mapping['.root']
+        with open(os.path.join(root, 'new.py'), 'w', encoding='utf-8'):
+            pass
+        os.utime(root, (1, 1))
+        self.assertIsNotNone(self._find(self.get_finder(root), 'new'))
+
+    def test_index_corrupt(self):
+        mapping = self.create_indexed('mod')
+        root = mapping['.root']
+        with open(self.index_path(root), 'wb') as file:
+            file.write(b'\0')
+        self.assertIsNotNone(self._find(self.get_finder(root), 'mod'))
+        with open(self.index_path(root), 'rb') as file:
+            self.assertNotEqual(file.read(), b'\0')
+
+    def test_index_package_init_removed(self):
+        mapping = self.create_indexed('pkg.__init__', 'pkg')
+        root = mapping['.root']
+        os.unlink(mapping['pkg.__init__'])
+        spec = self.get_finder(root).find_spec('pkg')
+        self.assertEqual(spec.origin, mapping['pkg'])
+
+    def test_index_package_init_added(self):
+        mapping = self.create_indexed('ns.mod')
+        root = mapping['.root']
+        init = os.path.join(root, 'ns', '__init__.py')
+        with open(init, 'w', encoding='utf-8'):
+            pass
+        spec = self.get_finder(root).find_spec('ns')
+        self.assertEqual(spec.origin, init)
+
+    def test_dont_write_bytecode(self):
+        with util.create_modules('mod') as mapping:
+            root = mapping['.root']
+            os.utime(root, (0, 0))
+            with swap_item(sys.__dict__, 'dont_write_bytecode', True):
+                self.assertIsNotNone(self._find(self.get_finder(root), 'mod'))
+            self.assertFalse(os.path.exists(self.index_path(root)))
+
+
+(Frozen_IndexFinderTests,
+ Source_IndexFinderTests
+ ) = util.test_both(IndexFinderTests, machinery=machinery)
+
+
 (Frozen_FinderTestsPEP420,
  Source_FinderTestsPEP420
  ) = util.test_both(FinderTestsPEP420, machinery=machinery)
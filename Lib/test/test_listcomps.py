@@ -111,6 +111,40 @@
     >>> [x() for x in items]
     [2, 2, 2, 2, 2]
 
+Comprehensions in functions are compiled inline, their variables must
+still not leak into the function or clobber its own variables
+
+    >>> def test_func(x):
+    ...     r = [x for x in range(x)]
+    ...     return r, x, sorted(locals())
+    >>> test_func(3)
+    ([0, 1, 2], 3, ['r', 'x'])
+
+    >>> def test_func():
+    ...     r = [(i, j) for i in range(2) for j in 'ab']
+    ...     return r, 'i' in locals(), 'j' in locals()
+    >>> test_func()
+    ([(0, 'a'), (0, 'b'), (1, 'a'), (1, 'b')], False, False)
+
+    >>> def test_func():
+    ...     return [not_defined for x in range(2)]
+    >>> test_func()
+    Traceback (most recent call last):
+      ...
+    NameError: name 'not_defined' is not defined
+
+    >>> def test_func(data):
+    ...     return [last := x * 2 for x in data], last
+    >>> test_func([1, 2, 3])
+    ([2, 4, 6], 6)
+
+    >>> def test_func():
+    ...     k = 10
+    ...     f = lambda: k
+    ...     return {i: k + i for i in range(2)}, {k - i for i in range(2)}, f()
+    >>> test_func()
+    ({0: 10, 1: 11}, {9, 10}, 10)
+
 We also repeat each of the above scoping tests inside a function
 
     >>> def test_func():
@@ -135,6 +135,55 @@ def test_same_filename_used(self):
             if isinstance(obj, types.CodeType):
                 self.assertIs(co.co_filename, obj.co_filename)
 
+    @support.cpython_only
+    def test_lazy_code(self):
+        s = ("def f(x):\n"
+             "    def g(): return x + 1\n"
+             "    return g\n"
+             "class C:\n"
+             "    def m(self): return [i for i in range(3)]\n")
+        co = compile(s, "myfile", "exec")
+        data = marshal.dumps(co, 5)
+        self.assertIn(b'L', data)
+        # Lazy code objects are written back unchanged
+        new = marshal.loads(data)
+        self.assertEqual(marshal.dumps(new, 5), data)
+        self.assertEqual(marshal.loads(marshal.dumps(new)), co)
+        # Nested code objects are read when a function is made from them
+        new = marshal.loads(data)
+        ns = {}
+        exec(new, ns)
+        self.assertEqual(ns['f'](1)(), 2)
+        self.assertEqual(ns['C']().m(), [0, 1, 2])
+        # ... or when the constants are accessed
+        for new in (marshal.loads(data),
+                    marshal.loads(memoryview(b'xx' + data)[2:]),
+                    marshal.loads(bytearray(data))):
+            self.assertEqual(new, co)
+            self.assertEqual(hash(new), hash(co))
+            self.assertIsInstance(new.co_consts[0], types.CodeType)
+            self.assertIs(new.co_consts[0].co_filename, new.co_filename)
+
+    def test_lazy_code_file(self):
+        co = compile("def f(): return 42", "myfile", "exec")
+        with open(os_helper.TESTFN, "wb") as f:
+            marshal.dump(co, f, 5)
+        try:
+            with open(os_helper.TESTFN, "rb") as f:
+                new = marshal.load(f)
+        finally:
+            os_helper.unlink(os_helper.TESTFN)
+        self.assertEqual(new, co)
+        ns = {}
+        exec(new, ns)
+        self.assertEqual(ns['f'](), 42)
+
+    def test_bad_lazy_code(self):
+        blob = marshal.dumps(1)
+        data = b'L' + len(blob).to_bytes(4, 'little') + blob
+        self.assertRaises(ValueError, marshal.loads, data)
+        self.assertRaises(EOFError, marshal.loads, data[:-1])
+
 class ContainerTestCase(unittest.TestCase, HelperMixin):
     d = {'astring': 'foo@bar.baz.spam',
          'afloat': 7283.43,
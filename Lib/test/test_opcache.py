@@ -1,4 +1,7 @@
+import sys
+import textwrap
 import unittest
+from test.support.script_helper import assert_python_ok
 
 class TestLoadAttrCache(unittest.TestCase):
     def test_descriptor_added_after_optimization(self):
@@ -21,3 +24,197 @@ def f(o):
         Descriptor.__set__ = lambda *args: None
 
         self.assertEqual(f(o), 2)
+
+
+class TestStoreAttrCache(unittest.TestCase):
+    def test_slot(self):
+        class C:
+            __slots__ = ('x',)
+
+        def f(o, v):
+            o.x = v
+
+        o = C()
+        for i in range(1025):
+            f(o, i)
+            self.assertEqual(o.x, i)
+
+        del o.x
+        f(o, 'a')
+        self.assertEqual(o.x, 'a')
+
+    def test_instance_dict(self):
+        class C:
+            def __init__(self):
+                self.x = None
+
+        def f(o, v):
+            o.x = v
+
+        for i in range(1025):
+            o = C()
+            f(o, i)
+            self.assertEqual(o.__dict__, {'x': i})
+
+        o = C()
+        del o.x
+        f(o, 1)
+        self.assertEqual(o.__dict__, {'x': 1})
+
+    def test_data_descriptor_added_after_optimization(self):
+        class C:
+            def __init__(self):
+                self.x = None
+
+        def f(o, v):
+            o.x = v
+
+        o = C()
+        for i in range(1025):
+            f(o, i)
+
+        setter_calls = []
+        C.x = property(lambda self: 2,
+                       lambda self, value: setter_calls.append(value))
+        f(o, 3)
+        self.assertEqual(setter_calls, [3])
+        self.assertEqual(o.x, 2)
+
+
+class TestBinarySubscrCache(unittest.TestCase):
+    def test_list_and_dict(self):
+        def f(c, k):
+            return c[k]
+
+        lst = [1, 2, 3]
+        d = {'a': 1, 'b': 2}
+        for i in range(1025):
+            self.assertEqual(f(lst, i % 3), lst[i % 3])
+            self.assertEqual(f(d, 'b'), 2)
+
+        self.assertEqual(f(lst, -1), 3)
+        self.assertEqual(f(lst, True), 2)
+        self.assertRaises(IndexError, f, lst, 3)
+        self.assertRaises(KeyError, f, d, 'c')
+        del d['a']
+        self.assertEqual(f(d, 'b'), 2)
+        self.assertEqual(f((4, 5), 1), 5)
+        self.assertEqual(f('xyz', 2), 'z')
+
+    def test_dict_subclass(self):
+        class D(dict):
+            def __missing__(self, key):
+                return key * 2
+
+        def f(c, k):
+            return c[k]
+
+        d = {'a': 1}
+        for i in range(1025):
+            self.assertEqual(f(d, 'a'), 1)
+        self.assertEqual(f(D(), 'ab'), 'abab')
+
+
+class TestCallFunctionCache(unittest.TestCase):
+    def test_callable_kind_changes(self):
+        def f(func, arg):
+            return func(arg)
+
+        def g(x):
+            return x + 1
+
+        for i in range(1025):
+            self.assertEqual(f(g, i), i + 1)
+            self.assertEqual(f(len, 'ab'), 2)
+
+        self.assertEqual(f(str, 1), '1')
+        self.assertEqual(f([].append, 1), None)
+        self.assertRaises(TypeError, f, len, 1)
+
+
+class TestOpcacheStats(unittest.TestCase):
+    def test_stats(self):
+        # Run in a subprocess: regrtest deactivates the opcode cache when
+        # hunting reference leaks.
+        code = textwrap.dedent("""
+            import sys
+
+            class C:
+                def __init__(self):
+                    self.x = 1
+
+            def f(o):
+                o.x = o.x + 1
+
+            def g():
+                return 1
+
+            o = C()
+            for i in range(1100):
+                f(o)
+            sys._set_opcache_stats(True)
+            for i in range(100):
+                f(o)
+                g()
+            sys._set_opcache_stats(False)
+            f(o)
+
+            stats = sys._opcache_stats(f.__code__)
+            assert stats['LOAD_ATTR']['hits'] == 100, stats
+            assert stats['STORE_ATTR']['hits'] == 100, stats
+            assert stats['STORE_ATTR']['deopts'] == 0, stats
+            totals = sys._opcache_stats()
+            assert totals['LOAD_ATTR']['hits'] >= 100, totals
+            # g() never ran often enough to get an opcode cache
+            stats = sys._opcache_stats(g.__code__)
+            assert all(n == 0 for counts in stats.values()
+                       for n in counts.values()), stats
+        """)
+        assert_python_ok('-c', code)
+
+    def test_invalid_argument(self):
+        self.assertRaises(TypeError, sys._opcache_stats, 'not code')
+
+
+class TestQuickening(unittest.TestCase):
+    def test_line_events_after_quickening(self):
+        def f(a):
+            b = a
+            c = b
+            return c
+
+        def trace_lines(func):
+            events = []
+            def tracer(frame, event, arg):
+                if frame.f_code is func.__code__ and event == 'line':
+                    events.append(frame.f_lineno)
+                return tracer
+            sys.settrace(tracer)
+            try:
+                func(1)
+            finally:
+                sys.settrace(None)
+            return events
+
+        expected = trace_lines(f)
+        for i in range(1025):
+            self.assertEqual(f(i), i)
+        self.assertEqual(trace_lines(f), expected)
+
+    def test_error_in_second_instruction(self):
+        def f(a):
+            if a:
+                x = 1
+            return (a,
+                    x)
+
+        for i in range(1025):
+            self.assertEqual(f(True), (True, 1))
+
+        try:
+            f(False)
+        except UnboundLocalError as exc:
+            tb = exc.__traceback__.tb_next
+        else:
+            self.fail("UnboundLocalError not raised")
+        self.assertEqual(tb.tb_lineno, f.__code__.co_firstlineno + 4)
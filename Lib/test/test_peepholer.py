@@ -252,6 +252,48 @@ def test_folding_of_binops_on_constants(self):
         self.assertNotIn(2**1000, code.co_consts)
         self.check_lnotab(code)
 
+    def test_propagate_constant_to_local(self):
+        def f():
+            x = 2; return x * 3
+        self.assertNotInBytecode(f, 'LOAD_FAST')
+        self.assertInBytecode(f, 'STORE_FAST', 'x')
+        self.assertEqual(f(), 6)
+        self.check_lnotab(f)
+
+        # A trace function may rebind the local at the next line
+        def g():
+            x = 2
+            return x * 3
+        self.assertInBytecode(g, 'LOAD_FAST', 'x')
+
+    def test_elim_self_assignment(self):
+        # Only the first assignment checks that x is bound
+        def f(x):
+            x = x; x = x; x = x; return x
+        self.assertEqual(count_instr_recursively(f, 'STORE_FAST'), 1)
+        self.assertEqual(f(1), 1)
+
+        # An unbound local must still raise
+        def g():
+            x = x
+        self.assertInBytecode(g, 'STORE_FAST', 'x')
+        self.assertRaises(UnboundLocalError, g)
+
+    def test_elim_dead_store(self):
+        def f(a, b):
+            x, x = a, b; return x
+        self.assertEqual(count_instr_recursively(f, 'STORE_FAST'), 1)
+        self.assertEqual(f(1, 2), 2)
+        self.check_lnotab(f)
+
+        # The first value may be observed before it is overwritten
+        def g(a, b):
+            x = a; x = b(); return x
+        self.assertEqual(count_instr_recursively(g, 'STORE_FAST'), 2)
+        def h(a):
+            x = a; del x; x = a
+        self.assertEqual(count_instr_recursively(h, 'STORE_FAST'), 2)
+
     def test_binary_subscr_on_unicode(self):
         # valid code get optimized
         code = compile('"foo"[0]', '', 'single')
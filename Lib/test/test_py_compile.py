@@ -1,5 +1,6 @@
 import functools
 import importlib.util
+import marshal
 import os
 import py_compile
 import shutil
@@ -194,6 +195,18 @@ def test_invalidation_mode(self):
                 fp.read(), 'test', {})
         self.assertEqual(flags, 0b1)
 
+    def test_lazy(self):
+        with open(self.source_path, 'w') as file:
+            file.write('def f(): return 123\n')
+        py_compile.compile(self.source_path, lazy=True)
+        with open(self.cache_path, 'rb') as fp:
+            data = fp.read()
+        self.assertIn(b'L', data[16:])
+        code = marshal.loads(data[16:])
+        ns = {}
+        exec(code, ns)
+        self.assertEqual(ns['f'](), 123)
+
     def test_quiet(self):
         bad_coding = os.path.join(os.path.dirname(__file__), 'bad_coding2.py')
         with support.captured_stderr() as stderr:
@@ -720,8 +720,9 @@ def test_synopsis(self):
     @unittest.skipIf(sys.flags.optimize >= 2,
                      'Docstrings are omitted with -OO and above')
     def test_synopsis_sourceless(self):
-        expected = os.__doc__.splitlines()[0]
-        filename = os.__cached__
+        # os may be frozen and have no __cached__
+        expected = pydoc.__doc__.splitlines()[0]
+        filename = pydoc.__cached__
         synopsis = pydoc.synopsis(filename)
 
         self.assertEqual(synopsis, expected)
@@ -213,6 +213,23 @@ def test_eval_str_u(self):
         self.assertRaises(SyntaxError, eval, """ bu'' """)
         self.assertRaises(SyntaxError, eval, """ ub'' """)
 
+    def test_eval_str_long(self):
+        # The tokenizer scans string bodies in blocks of bytes, put the
+        # quotes, escapes and newlines at every offset of a block.
+        for n in range(40):
+            pad = 'x' * n
+            self.assertEqual(eval(f"'{pad}'"), pad)
+            self.assertEqual(eval(f"'{pad}\\'{pad}'"), f"{pad}'{pad}")
+            self.assertEqual(eval(f"'{pad}\\\\'"), f"{pad}\\")
+            self.assertEqual(eval(f"'{pad}\"{pad}'"), f'{pad}"{pad}')
+            self.assertEqual(eval(f"'''{pad}''y{pad}'''"), f"{pad}''y{pad}")
+            self.assertEqual(eval(f"'''{pad}\n{pad}'''"), f"{pad}\n{pad}")
+            self.assertEqual(eval(f"'''{pad}\\\n{pad}'''"), pad * 2)
+            self.assertEqual(eval(f"'{pad}€{pad}'"), f"{pad}€{pad}")
+            self.assertRaises(SyntaxError, eval, f"'{pad}\n'")
+            self.assertRaises(SyntaxError, eval, f"'{pad}")
+            self.assertRaises(SyntaxError, eval, f"'''{pad}''")
+
     def check_encoding(self, encoding, extra=""):
         modname = "xx_" + encoding.replace("-", "_")
         fn = os.path.join(self.tmpdir, modname + ".py")
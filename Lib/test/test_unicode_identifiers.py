@@ -1,3 +1,4 @@
+import unicodedata
 import unittest
 
 class PEP3131Test(unittest.TestCase):
@@ -17,6 +18,18 @@ def test_non_bmp_normalized(self):
         𝔘𝔫𝔦𝔠𝔬𝔡𝔢 = 1
         self.assertIn("Unicode", dir())
 
+    def test_long(self):
+        # The tokenizer scans identifiers in blocks of bytes, put the
+        # non-ASCII characters at every offset of a block.
+        for n in range(40):
+            for c in ('_', '9', '\xe4', '蟒', '\U0001d518'):
+                name = 'a' * (n + 1) + c + 'b' * (40 - n)
+                ns = {}
+                exec(f"{name} = 1\n#{name}\n", ns)
+                self.assertIn(unicodedata.normalize('NFKC', name), ns)
+            name = 'a' * (n + 1) + '€' + 'b' * 20
+            self.assertRaises(SyntaxError, compile, f"{name} = 1", '<s>', 'exec')
+
     def test_invalid(self):
         try:
             from test import badsyntax_3131
@@ -372,4 +372,216 @@ gc_get_freeze_count(PyObject *module, PyObject *Py_UNUSED(ignored))
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=61e15f3a549f3ab5 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(gc_set_incremental__doc__,
+"set_incremental($module, /, max_pause_ms)\n"
+"--\n"
+"\n"
+"Make automatic collections of the oldest generation incremental.\n"
+"\n"
+"Each of them then examines only as many objects of the oldest generation as\n"
+"it can in about max_pause_ms milliseconds, starting where the previous one\n"
+"stopped.  Reference cycles too large to be examined at once are only freed\n"
+"by collect().  A max_pause_ms of 0 restores full collections.");
+
+#define GC_SET_INCREMENTAL_METHODDEF    \
+    {"set_incremental", (PyCFunction)(void(*)(void))gc_set_incremental, METH_FASTCALL|METH_KEYWORDS, gc_set_incremental__doc__},
+
+static PyObject *
+gc_set_incremental_impl(PyObject *module, double max_pause_ms);
+
+static PyObject *
+gc_set_incremental(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"max_pause_ms", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "set_incremental", 0};
+    PyObject *argsbuf[1];
+    double max_pause_ms;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    if (PyFloat_CheckExact(args[0])) {
+        max_pause_ms = PyFloat_AS_DOUBLE(args[0]);
+    }
+    else
+    {
+        max_pause_ms = PyFloat_AsDouble(args[0]);
+        if (max_pause_ms == -1.0 && PyErr_Occurred()) {
+            goto exit;
+        }
+    }
+    return_value = gc_set_incremental_impl(module, max_pause_ms);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_incremental__doc__,
+"get_incremental($module, /)\n"
+"--\n"
+"\n"
+"Return the pause budget of incremental collections, in milliseconds.\n"
+"\n"
+"Return 0 if automatic collections of the oldest generation are full ones.");
+
+#define GC_GET_INCREMENTAL_METHODDEF    \
+    {"get_incremental", (PyCFunction)gc_get_incremental, METH_NOARGS, gc_get_incremental__doc__},
+
+static double
+gc_get_incremental_impl(PyObject *module);
+
+static PyObject *
+gc_get_incremental(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    double _return_value;
+
+    _return_value = gc_get_incremental_impl(module);
+    if ((_return_value == -1.0) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyFloat_FromDouble(_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_set_adaptive__doc__,
+"set_adaptive($module, /, enable)\n"
+"--\n"
+"\n"
+"Adapt the collection thresholds to the amount of garbage found.\n"
+"\n"
+"When enabled, the threshold of a generation is raised after a collection\n"
+"which found almost no garbage, and lowered back after one which found a\n"
+"lot, but never below the one set by set_threshold().  The thresholds in\n"
+"use are reported by get_stats().");
+
+#define GC_SET_ADAPTIVE_METHODDEF    \
+    {"set_adaptive", (PyCFunction)(void(*)(void))gc_set_adaptive, METH_FASTCALL|METH_KEYWORDS, gc_set_adaptive__doc__},
+
+static PyObject *
+gc_set_adaptive_impl(PyObject *module, int enable);
+
+static PyObject *
+gc_set_adaptive(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"enable", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "set_adaptive", 0};
+    PyObject *argsbuf[1];
+    int enable;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    enable = PyObject_IsTrue(args[0]);
+    if (enable < 0) {
+        goto exit;
+    }
+    return_value = gc_set_adaptive_impl(module, enable);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_adaptive__doc__,
+"get_adaptive($module, /)\n"
+"--\n"
+"\n"
+"Return true if the collection thresholds are adapted.");
+
+#define GC_GET_ADAPTIVE_METHODDEF    \
+    {"get_adaptive", (PyCFunction)gc_get_adaptive, METH_NOARGS, gc_get_adaptive__doc__},
+
+static int
+gc_get_adaptive_impl(PyObject *module);
+
+static PyObject *
+gc_get_adaptive(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = gc_get_adaptive_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyBool_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_set_parallel__doc__,
+"set_parallel($module, /, nthreads)\n"
+"--\n"
+"\n"
+"Set the number of threads used to collect large generations.\n"
+"\n"
+"Collections examining many objects then split the work between the calling\n"
+"thread and nthreads - 1 worker threads.  A value of 1 disables this.  The\n"
+"tp_traverse functions of all the tracked objects must then be safe to call\n"
+"from a thread not holding the GIL.");
+
+#define GC_SET_PARALLEL_METHODDEF    \
+    {"set_parallel", (PyCFunction)(void(*)(void))gc_set_parallel, METH_FASTCALL|METH_KEYWORDS, gc_set_parallel__doc__},
+
+static PyObject *
+gc_set_parallel_impl(PyObject *module, int nthreads);
+
+static PyObject *
+gc_set_parallel(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    static const char * const _keywords[] = {"nthreads", NULL};
+    static _PyArg_Parser _parser = {NULL, _keywords, "set_parallel", 0};
+    PyObject *argsbuf[1];
+    int nthreads;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser, 1, 1, 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    nthreads = _PyLong_AsInt(args[0]);
+    if (nthreads == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = gc_set_parallel_impl(module, nthreads);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(gc_get_parallel__doc__,
+"get_parallel($module, /)\n"
+"--\n"
+"\n"
+"Return the number of threads used to collect large generations.");
+
+#define GC_GET_PARALLEL_METHODDEF    \
+    {"get_parallel", (PyCFunction)gc_get_parallel, METH_NOARGS, gc_get_parallel__doc__},
+
+static int
+gc_get_parallel_impl(PyObject *module);
+
+static PyObject *
+gc_get_parallel(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    PyObject *return_value = NULL;
+    int _return_value;
+
+    _return_value = gc_get_parallel_impl(module);
+    if ((_return_value == -1) && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = PyLong_FromLong((long)_return_value);
+
+exit:
+    return return_value;
+}
+/*[clinic end generated code: output=409a2b6198914de9 input=a9049054013a1b77]*/
@@ -68,6 +68,11 @@ module gc
 // most gc_list_* functions for it.
 #define NEXT_MASK_UNREACHABLE  (1)
 
+#ifdef HAVE_BUILTIN_ATOMIC
+/* Collections can use worker threads, see deduce_unreachable_parallel() */
+#  define GC_PARALLEL
+#endif
+
 /* Get an object's GC head */
 #define AS_GC(o) ((PyGC_Head *)(o)-1)
 
@@ -127,6 +132,23 @@ gc_decref(PyGC_Head *g)
 
 #define GEN_HEAD(gcstate, n) (&(gcstate)->generations[n].head)
 
+/* Initial estimate of the number of objects examined per millisecond by an
+ * incremental collection, before one has been timed.  Deliberately low. */
+#define INITIAL_INCREMENTAL_RATE 10000.0
+
+/* Lower bound of the number of objects of the oldest generation examined by
+ * an incremental collection, so that it always makes some progress. */
+#define MIN_INCREMENT_SIZE 1000
+
+/* In adaptive mode, the threshold of a generation is doubled after a
+ * collection where less than 1/ADAPTIVE_LOW_GARBAGE of the objects examined
+ * were garbage, and halved after one where more than 1/ADAPTIVE_HIGH_GARBAGE
+ * were.  It stays between the threshold set by gc.set_threshold() and
+ * ADAPTIVE_MAX_FACTOR times that. */
+#define ADAPTIVE_LOW_GARBAGE 100
+#define ADAPTIVE_HIGH_GARBAGE 10
+#define ADAPTIVE_MAX_FACTOR 64
+
 
 static GCState *
 get_gc_state(void)
@@ -157,6 +179,13 @@ _PyGC_InitState(GCState *gcstate)
            (uintptr_t)&gcstate->permanent_generation.head}, 0, 0
     };
     gcstate->permanent_generation = permanent_generation;
+    gcstate->incremental_pause = 0.0;
+    gcstate->incremental_rate = INITIAL_INCREMENTAL_RATE;
+    gcstate->adaptive = 0;
+    gcstate->parallel_threads = 1;
+    for (int i = 0; i < NUM_GENERATIONS; i++) {
+        gcstate->base_thresholds[i] = gcstate->generations[i].threshold;
+    }
 }
 
 
@@ -418,12 +447,15 @@ validate_list(PyGC_Head *head, enum flagstates flags)
 
 /* Set all gc_refs = ob_refcnt.  After this, gc_refs is > 0 and
  * PREV_MASK_COLLECTING bit is set for all objects in containers.
+ * Return the number of objects in containers.
  */
-static void
+static Py_ssize_t
 update_refs(PyGC_Head *containers)
 {
+    Py_ssize_t n = 0;
     PyGC_Head *gc = GC_NEXT(containers);
     for (; gc != containers; gc = GC_NEXT(gc)) {
+        n++;
         gc_reset_refs(gc, Py_REFCNT(FROM_GC(gc)));
         /* Python's cyclic gc should never see an incoming refcount
          * of 0:  if something decref'ed to 0, it should have been
@@ -445,6 +477,7 @@ update_refs(PyGC_Head *containers)
          */
         _PyObject_ASSERT(FROM_GC(gc), gc_get_refs(gc) != 0);
     }
+    return n;
 }
 
 /* A traversal callback for subtract_refs. */
@@ -1092,8 +1125,10 @@ IMPORTANT: This function leaves 'unreachable' with the NEXT_MASK_UNREACHABLE
 flag set but it does not clear it to skip unnecessary iteration. Before the
 flag is cleared (for example, by using 'clear_unreachable_mask' function or
 by a call to 'move_legacy_finalizers'), the 'unreachable' list is not a normal
-list and we can not use most gc_list_* functions for it. */
-static inline void
+list and we can not use most gc_list_* functions for it.
+
+Return the number of objects initially in "base". */
+static inline Py_ssize_t
 deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
     validate_list(base, collecting_clear_unreachable_clear);
     /* Using ob_refcnt and gc_refs, calculate which objects in the
@@ -1101,7 +1136,7 @@ deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
      * refcount greater than 0 when all the references within the
      * set are taken into account).
      */
-    update_refs(base);  // gc_prev is used for gc_refs
+    Py_ssize_t n = update_refs(base);  // gc_prev is used for gc_refs
     subtract_refs(base);
 
     /* Leave everything reachable from outside base in base, and move
@@ -1143,8 +1178,394 @@ deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
     move_unreachable(base, unreachable);  // gc_prev is pointer again
     validate_list(base, collecting_clear_unreachable_clear);
     validate_list(unreachable, collecting_set_unreachable_set);
+    return n;
+}
+
+#ifdef GC_PARALLEL
+/* Parallel collection of large generations (see gc.set_parallel()).
+ *
+ * The first two steps of deduce_unreachable() are split between the calling
+ * thread and a pool of worker threads, which don't need the GIL: they only
+ * call tp_traverse and update the GC headers with atomic operations.
+ *
+ * update_refs() is done by the calling thread, which also cuts the list in
+ * chunks of PARALLEL_CHUNK_SIZE objects.  The threads then take chunks in
+ * turn, first to subtract the internal references (with atomic decrements,
+ * since several threads may decrement the gc_refs of the same object), then
+ * to mark everything reachable from the objects whose gc_refs is positive.
+ * The list isn't modified until all the threads are done: the mark is a flag
+ * in _gc_next, which is set atomically by the thread which gets to traverse
+ * the object.  Finally, sweep_unreachable() moves the unmarked objects to
+ * the unreachable list, leaving both lists as move_unreachable() does.
+ */
+
+/* Generations smaller than this are collected by the calling thread only. */
+#define PARALLEL_MIN_OBJECTS 100000
+#define PARALLEL_CHUNK_SIZE 4096
+
+// Lowest bit of _gc_next is set on the objects marked reachable while
+// marking in parallel.  It is the same bit as NEXT_MASK_UNREACHABLE, which
+// isn't used until sweep_unreachable() removes the marks.
+#define NEXT_MASK_REACHED  (1)
+
+enum parallel_phase {
+    PARALLEL_SUBTRACT_REFS,
+    PARALLEL_MARK_REACHABLE,
+};
+
+/* The work shared by the threads.  Like the rest of the collector state,
+ * it is protected by the GIL: only one parallel collection can run at
+ * a time. */
+static struct {
+    enum parallel_phase phase;
+    /* chunks[i] is the first object of chunk i, chunks[nchunks] is the head
+       of the list */
+    PyGC_Head **chunks;
+    Py_ssize_t nchunks;
+    /* index of the next chunk to process */
+    Py_ssize_t next_chunk;
+    /* number of threads which haven't finished the current phase */
+    int pending;
+    /* set if marking failed for lack of memory */
+    int failed;
+    /* released by the last thread to finish the current phase */
+    PyThread_type_lock done;
+} parallel_job;
+
+/* The worker threads, started on demand and never stopped. */
+static struct {
+    int nworkers;
+    /* start[i] is released to make worker i run the current phase */
+    PyThread_type_lock *start;
+#ifdef HAVE_GETPID
+    /* the workers don't survive fork() */
+    pid_t pid;
+#endif
+} parallel_pool;
+
+/* A stack of objects to traverse while marking, private to a thread. */
+typedef struct {
+    PyGC_Head **items;
+    Py_ssize_t size;
+    Py_ssize_t allocated;
+} mark_stack;
+
+static int
+mark_stack_push(mark_stack *stack, PyGC_Head *gc)
+{
+    if (stack->size == stack->allocated) {
+        Py_ssize_t allocated = stack->allocated ? stack->allocated * 2 : 1024;
+        PyGC_Head **items = PyMem_RawRealloc(stack->items,
+                                             allocated * sizeof(PyGC_Head *));
+        if (items == NULL) {
+            return -1;
+        }
+        stack->items = items;
+        stack->allocated = allocated;
+    }
+    stack->items[stack->size++] = gc;
+    return 0;
+}
+
+static inline uintptr_t
+gc_load_prev_atomic(PyGC_Head *g)
+{
+    return __atomic_load_n(&g->_gc_prev, __ATOMIC_RELAXED);
+}
+
+/* Mark gc as reachable.  Return 1 if the calling thread must traverse it,
+ * 0 if it was already marked. */
+static inline int
+gc_mark_reached(PyGC_Head *gc)
+{
+    uintptr_t next = __atomic_fetch_or(&gc->_gc_next, NEXT_MASK_REACHED,
+                                       __ATOMIC_RELAXED);
+    return (next & NEXT_MASK_REACHED) == 0;
+}
+
+/* A traversal callback for parallel_subtract_refs(). */
+static int
+visit_decref_atomic(PyObject *op, void *parent)
+{
+    _PyObject_ASSERT(_PyObject_CAST(parent), !_PyObject_IsFreed(op));
+
+    if (_PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        if (gc_load_prev_atomic(gc) & PREV_MASK_COLLECTING) {
+            uintptr_t prev = __atomic_fetch_sub(&gc->_gc_prev,
+                                                1 << _PyGC_PREV_SHIFT,
+                                                __ATOMIC_RELAXED);
+            _PyObject_ASSERT_WITH_MSG(op,
+                                      (prev >> _PyGC_PREV_SHIFT) > 0,
+                                      "refcount is too small");
+            (void)prev;
+        }
+    }
+    return 0;
+}
+
+/* A traversal callback for parallel_mark_reachable(). */
+static int
+visit_mark(PyObject *op, mark_stack *stack)
+{
+    if (_PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        if ((gc_load_prev_atomic(gc) & PREV_MASK_COLLECTING)
+            && gc_mark_reached(gc))
+        {
+            return mark_stack_push(stack, gc);
+        }
+    }
+    return 0;
+}
+
+static void
+parallel_subtract_refs(PyGC_Head *first, PyGC_Head *end)
+{
+    for (PyGC_Head *gc = first; gc != end; gc = GC_NEXT(gc)) {
+        PyObject *op = FROM_GC(gc);
+        (void) Py_TYPE(op)->tp_traverse(op, visit_decref_atomic, op);
+    }
+}
+
+static int
+parallel_mark_reachable(PyGC_Head *first, PyGC_Head *end, mark_stack *stack)
+{
+    for (PyGC_Head *gc = first; gc != end;
+         gc = (PyGC_Head *)(__atomic_load_n(&gc->_gc_next, __ATOMIC_RELAXED)
+                            & ~NEXT_MASK_REACHED))
+    {
+        if ((gc_load_prev_atomic(gc) >> _PyGC_PREV_SHIFT) == 0
+            || !gc_mark_reached(gc))
+        {
+            /* not directly reachable, or already marked */
+            continue;
+        }
+        if (mark_stack_push(stack, gc) < 0) {
+            return -1;
+        }
+        while (stack->size > 0) {
+            PyObject *op = FROM_GC(stack->items[--stack->size]);
+            if (Py_TYPE(op)->tp_traverse(op, (visitproc)visit_mark,
+                                         stack) < 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Process chunks of the current phase until there are none left. */
+static void
+parallel_run_phase(void)
+{
+    mark_stack stack = {NULL, 0, 0};
+    for (;;) {
+        Py_ssize_t i = __atomic_fetch_add(&parallel_job.next_chunk, 1,
+                                          __ATOMIC_RELAXED);
+        if (i >= parallel_job.nchunks) {
+            break;
+        }
+        PyGC_Head *first = parallel_job.chunks[i];
+        PyGC_Head *end = parallel_job.chunks[i + 1];
+        if (parallel_job.phase == PARALLEL_SUBTRACT_REFS) {
+            parallel_subtract_refs(first, end);
+        }
+        else if (__atomic_load_n(&parallel_job.failed, __ATOMIC_RELAXED)
+                 || parallel_mark_reachable(first, end, &stack) < 0)
+        {
+            __atomic_store_n(&parallel_job.failed, 1, __ATOMIC_RELAXED);
+        }
+    }
+    PyMem_RawFree(stack.items);
+    if (__atomic_sub_fetch(&parallel_job.pending, 1, __ATOMIC_ACQ_REL) == 0) {
+        PyThread_release_lock(parallel_job.done);
+    }
+}
+
+static void
+parallel_worker(void *arg)
+{
+    PyThread_type_lock start = (PyThread_type_lock)arg;
+    for (;;) {
+        PyThread_acquire_lock(start, WAIT_LOCK);
+        parallel_run_phase();
+    }
+}
+
+/* Make sure at least nworkers worker threads are waiting for work.  Return
+ * the number of workers available, which may be less on failure. */
+static int
+parallel_pool_start(int nworkers)
+{
+#ifdef HAVE_GETPID
+    if (parallel_pool.nworkers > 0 && parallel_pool.pid != getpid()) {
+        /* Forked: the worker threads are gone, and their locks may be in
+           any state.  Leak them. */
+        parallel_pool.nworkers = 0;
+        parallel_pool.start = NULL;
+        parallel_job.done = NULL;
+    }
+    parallel_pool.pid = getpid();
+#endif
+    if (parallel_job.done == NULL) {
+        parallel_job.done = PyThread_allocate_lock();
+        if (parallel_job.done == NULL) {
+            return 0;
+        }
+        PyThread_acquire_lock(parallel_job.done, WAIT_LOCK);
+    }
+    if (nworkers <= parallel_pool.nworkers) {
+        return nworkers;
+    }
+    PyThread_type_lock *start = PyMem_RawRealloc(
+        parallel_pool.start, nworkers * sizeof(PyThread_type_lock));
+    if (start == NULL) {
+        return parallel_pool.nworkers;
+    }
+    parallel_pool.start = start;
+    while (parallel_pool.nworkers < nworkers) {
+        PyThread_type_lock lock = PyThread_allocate_lock();
+        if (lock == NULL) {
+            break;
+        }
+        PyThread_acquire_lock(lock, WAIT_LOCK);
+        if (PyThread_start_new_thread(parallel_worker, lock)
+            == PYTHREAD_INVALID_THREAD_ID) {
+            PyThread_free_lock(lock);
+            break;
+        }
+        start[parallel_pool.nworkers++] = lock;
+    }
+    return parallel_pool.nworkers;
+}
+
+/* Run a phase on the calling thread and nworkers worker threads. */
+static void
+parallel_run(enum parallel_phase phase, int nworkers)
+{
+    parallel_job.phase = phase;
+    parallel_job.next_chunk = 0;
+    parallel_job.pending = nworkers + 1;
+    for (int i = 0; i < nworkers; i++) {
+        PyThread_release_lock(parallel_pool.start[i]);
+    }
+    parallel_run_phase();
+    PyThread_acquire_lock(parallel_job.done, WAIT_LOCK);
+}
+
+/* Like update_refs(), but also cut containers in chunks for the worker
+ * threads.  Return the number of objects, or -1 if out of memory. */
+static Py_ssize_t
+update_refs_chunked(PyGC_Head *containers)
+{
+    Py_ssize_t n = 0, allocated = 0;
+    PyGC_Head **chunks = NULL;
+    PyGC_Head *gc = GC_NEXT(containers);
+    for (; gc != containers; gc = GC_NEXT(gc)) {
+        if (n % PARALLEL_CHUNK_SIZE == 0) {
+            Py_ssize_t i = n / PARALLEL_CHUNK_SIZE;
+            if (i + 1 >= allocated) {
+                allocated = allocated ? allocated * 2 : 256;
+                PyGC_Head **p = PyMem_RawRealloc(chunks,
+                                                 allocated * sizeof(*chunks));
+                if (p == NULL) {
+                    PyMem_RawFree(chunks);
+                    return -1;
+                }
+                chunks = p;
+            }
+            chunks[i] = gc;
+        }
+        n++;
+        gc_reset_refs(gc, Py_REFCNT(FROM_GC(gc)));
+        _PyObject_ASSERT(FROM_GC(gc), gc_get_refs(gc) != 0);
+    }
+    parallel_job.nchunks = (n + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE;
+    if (chunks != NULL) {
+        chunks[parallel_job.nchunks] = containers;
+    }
+    parallel_job.chunks = chunks;
+    return n;
 }
 
+/* Move the objects of young which were not marked to unreachable, and
+ * remove the marks.  Like move_unreachable(), restore the _gc_prev
+ * pointers, clear PREV_MASK_COLLECTING in young, and leave unreachable
+ * with NEXT_MASK_UNREACHABLE set. */
+static void
+sweep_unreachable(PyGC_Head *young, PyGC_Head *unreachable)
+{
+    PyGC_Head *prev = young;
+    PyGC_Head *gc = GC_NEXT(young);
+    while (gc != young) {
+        uintptr_t next = gc->_gc_next;
+        if (next & NEXT_MASK_REACHED) {
+            prev->_gc_next = (uintptr_t)gc;
+            _PyGCHead_SET_PREV(gc, prev);
+            gc_clear_collecting(gc);
+            prev = gc;
+        }
+        else {
+            PyGC_Head *last = GC_PREV(unreachable);
+            last->_gc_next = (NEXT_MASK_UNREACHABLE | (uintptr_t)gc);
+            _PyGCHead_SET_PREV(gc, last);
+            gc->_gc_next = (NEXT_MASK_UNREACHABLE | (uintptr_t)unreachable);
+            unreachable->_gc_prev = (uintptr_t)gc;
+        }
+        gc = (PyGC_Head *)(next & ~NEXT_MASK_REACHED);
+    }
+    prev->_gc_next = (uintptr_t)young;
+    young->_gc_prev = (uintptr_t)prev;
+    unreachable->_gc_next &= ~NEXT_MASK_UNREACHABLE;
+}
+
+/* Parallel version of deduce_unreachable(), using up to nthreads threads.
+ * It falls back to the sequential algorithm for small lists, or if the
+ * worker threads or memory are lacking. */
+static Py_ssize_t
+deduce_unreachable_parallel(PyGC_Head *base, PyGC_Head *unreachable,
+                            int nthreads)
+{
+    validate_list(base, collecting_clear_unreachable_clear);
+    Py_ssize_t n = update_refs_chunked(base);
+    if (n < 0) {
+        n = update_refs(base);
+    }
+    int nworkers = 0;
+    if (parallel_job.chunks != NULL && n >= PARALLEL_MIN_OBJECTS) {
+        nworkers = parallel_pool_start(
+            (int)Py_MIN(nthreads - 1, parallel_job.nchunks - 1));
+    }
+    gc_list_init(unreachable);
+    if (nworkers == 0) {
+        subtract_refs(base);
+        move_unreachable(base, unreachable);
+    }
+    else {
+        parallel_run(PARALLEL_SUBTRACT_REFS, nworkers);
+        parallel_job.failed = 0;
+        parallel_run(PARALLEL_MARK_REACHABLE, nworkers);
+        if (parallel_job.failed) {
+            /* Out of memory: start marking again on this thread */
+            PyGC_Head *gc = GC_NEXT(base);
+            for (; gc != base; gc = GC_NEXT(gc)) {
+                gc->_gc_next &= ~NEXT_MASK_REACHED;
+            }
+            move_unreachable(base, unreachable);
+        }
+        else {
+            sweep_unreachable(base, unreachable);
+        }
+    }
+    PyMem_RawFree(parallel_job.chunks);
+    parallel_job.chunks = NULL;
+    validate_list(base, collecting_clear_unreachable_clear);
+    validate_list(unreachable, collecting_set_unreachable_set);
+    return n;
+}
+#endif /* GC_PARALLEL */
+
 /* Handle objects that may have resurrected after a call to 'finalize_garbage', moving
    them to 'old_generation' and placing the rest on 'still_unreachable'.
 
@@ -1177,12 +1598,146 @@ handle_resurrected_objects(PyGC_Head *unreachable, PyGC_Head* still_unreachable,
     gc_list_merge(resurrected, old_generation);
 }
 
+struct increment_state {
+    PyGC_Head *increment;
+    /* number of reachable objects which can still be added */
+    Py_ssize_t reachable;
+};
+
+/* A traversal callback for take_increment(). */
+static int
+visit_increment(PyObject *op, struct increment_state *state)
+{
+    if (state->reachable <= 0 || !_PyObject_IS_GC(op)) {
+        return 0;
+    }
+    PyGC_Head *gc = AS_GC(op);
+    // Skip untracked objects and the ones already taken.
+    if (gc->_gc_next == 0 || gc_is_collecting(gc)) {
+        return 0;
+    }
+    gc_list_move(gc, state->increment);
+    gc->_gc_prev |= PREV_MASK_COLLECTING;
+    state->reachable--;
+    return 0;
+}
+
+/* Move the younger generations and about 'size' objects of the oldest
+ * generation to 'increment', for an incremental collection.  Return the
+ * number of objects taken from the oldest generation.
+ *
+ * The objects are taken from the head of the oldest generation.  Since the
+ * survivors of a collection are appended to its tail, successive increments
+ * go around the whole generation.  Up to half of them are instead objects
+ * reachable from the ones taken, so that a reference cycle is not split
+ * between two increments, unless it is too large for one.  Such cycles are
+ * only freed by a full collection.
+ *
+ * Objects taken are marked with PREV_MASK_COLLECTING while the increment is
+ * built.  That flag can't tell apart the objects of the oldest generation
+ * from the ones of the permanent generation: references are not followed
+ * if gc.freeze() has been used.
+ */
+static Py_ssize_t
+take_increment(GCState *gcstate, PyGC_Head *increment, Py_ssize_t size)
+{
+    PyGC_Head *old = GEN_HEAD(gcstate, NUM_GENERATIONS-1);
+    struct increment_state state = {increment, size / 2};
+    if (!gc_list_is_empty(&gcstate->permanent_generation.head)) {
+        state.reachable = 0;
+    }
+
+    for (int i = 0; i < NUM_GENERATIONS-1; i++) {
+        gc_list_merge(GEN_HEAD(gcstate, i), increment);
+    }
+
+    /* Objects after gc have been taken from the oldest generation. */
+    PyGC_Head *gc = GC_PREV(increment);
+    Py_ssize_t n = 0;
+    while (n < size) {
+        if (GC_NEXT(gc) == increment) {
+            if (gc_list_is_empty(old)) {
+                break;
+            }
+            PyGC_Head *first = GC_NEXT(old);
+            gc_list_move(first, increment);
+            first->_gc_prev |= PREV_MASK_COLLECTING;
+            n++;
+        }
+        gc = GC_NEXT(gc);
+        if (state.reachable > 0) {
+            Py_ssize_t reachable = state.reachable;
+            traverseproc traverse = Py_TYPE(FROM_GC(gc))->tp_traverse;
+            (void) traverse(FROM_GC(gc),
+                            (visitproc)visit_increment,
+                            (void *)&state);
+            n += reachable - state.reachable;
+        }
+    }
+    gc_list_clear_collecting(increment);
+    return n;
+}
+
+/* Number of objects of the oldest generation an incremental collection
+ * should examine to stay within the pause budget. */
+static Py_ssize_t
+increment_size(GCState *gcstate)
+{
+    double size = gcstate->incremental_pause * gcstate->incremental_rate;
+    if (size < MIN_INCREMENT_SIZE) {
+        return MIN_INCREMENT_SIZE;
+    }
+    if (size > (double)PY_SSIZE_T_MAX) {
+        return PY_SSIZE_T_MAX;
+    }
+    return (Py_ssize_t)size;
+}
+
+/* Update the estimate used by increment_size() after an incremental
+ * collection examined 'n' objects of the oldest generation. */
+static void
+update_incremental_rate(GCState *gcstate, Py_ssize_t n, _PyTime_t elapsed)
+{
+    double ms = _PyTime_AsSecondsDouble(elapsed) * 1e3;
+    if (n < MIN_INCREMENT_SIZE || ms <= 0.0) {
+        /* too small to be timed reliably */
+        return;
+    }
+    gcstate->incremental_rate = (gcstate->incremental_rate + n / ms) / 2;
+}
+
+/* In adaptive mode, update the threshold of 'generation' after a collection
+ * which found 'garbage' objects among the 'examined' ones. */
+static void
+adapt_threshold(GCState *gcstate, int generation,
+                Py_ssize_t garbage, Py_ssize_t examined)
+{
+    struct gc_generation *gen = &gcstate->generations[generation];
+    Py_ssize_t base = gcstate->base_thresholds[generation];
+    Py_ssize_t threshold = gen->threshold;
+    if (base <= 0 || examined == 0) {
+        /* collection of generation 0 is disabled, or nothing to go by */
+        return;
+    }
+    if (garbage * ADAPTIVE_LOW_GARBAGE < examined) {
+        threshold = Py_MIN(threshold * 2, base * ADAPTIVE_MAX_FACTOR);
+        threshold = Py_MIN(threshold, INT_MAX);
+    }
+    else if (garbage * ADAPTIVE_HIGH_GARBAGE > examined) {
+        threshold = Py_MAX(threshold / 2, base);
+    }
+    gen->threshold = (int)threshold;
+}
+
 /* This is the main function.  Read this to understand how the
- * collection process works. */
+ * collection process works.
+ *
+ * If 'incremental' is true, 'generation' must be the oldest one, and only
+ * an increment of it is collected, see take_increment(). */
 static Py_ssize_t
 gc_collect_main(PyThreadState *tstate, int generation,
                 Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
-                int nofail)
+                int nofail, int incremental)
 {
     int i;
     Py_ssize_t m = 0; /* # objects collected */
@@ -1191,10 +1746,15 @@ gc_collect_main(PyThreadState *tstate, int generation,
     PyGC_Head *old; /* next older generation */
     PyGC_Head unreachable; /* non-problematic unreachable trash */
     PyGC_Head finalizers;  /* objects with, & reachable from, __del__ */
+    PyGC_Head increment;  /* objects examined by an incremental collection */
+    Py_ssize_t n_old = 0; /* # objects taken from the oldest generation */
     PyGC_Head *gc;
     _PyTime_t t1 = 0;   /* initialize to prevent a compiler warning */
+    _PyTime_t t_start = 0;
     GCState *gcstate = &tstate->interp->gc;
 
+    assert(!incremental || generation == NUM_GENERATIONS-1);
+
     // gc_collect_main() must not be called before _PyGC_Init
     // or after _PyGC_Fini()
     assert(gcstate->garbage != NULL);
@@ -1209,10 +1769,19 @@ gc_collect_main(PyThreadState *tstate, int generation,
 #endif
 
     if (gcstate->debug & DEBUG_STATS) {
-        PySys_WriteStderr("gc: collecting generation %d...\n", generation);
+        if (incremental) {
+            PySys_WriteStderr("gc: collecting an increment of generation %d...\n",
+                              generation);
+        }
+        else {
+            PySys_WriteStderr("gc: collecting generation %d...\n", generation);
+        }
         show_stats_each_generations(gcstate);
         t1 = _PyTime_GetMonotonicClock();
     }
+    if (incremental) {
+        t_start = _PyTime_GetMonotonicClock();
+    }
 
     if (PyDTrace_GC_START_ENABLED())
         PyDTrace_GC_START(generation);
@@ -1223,20 +1792,39 @@ gc_collect_main(PyThreadState *tstate, int generation,
     for (i = 0; i <= generation; i++)
         gcstate->generations[i].count = 0;
 
-    /* merge younger generations with one we are currently collecting */
-    for (i = 0; i < generation; i++) {
-        gc_list_merge(GEN_HEAD(gcstate, i), GEN_HEAD(gcstate, generation));
+    if (incremental) {
+        /* survivors go back to the tail of the oldest generation */
+        gc_list_init(&increment);
+        n_old = take_increment(gcstate, &increment, increment_size(gcstate));
+        young = &increment;
+        old = GEN_HEAD(gcstate, generation);
     }
+    else {
+        /* merge younger generations with one we are currently collecting */
+        for (i = 0; i < generation; i++) {
+            gc_list_merge(GEN_HEAD(gcstate, i), GEN_HEAD(gcstate, generation));
+        }
 
-    /* handy references */
-    young = GEN_HEAD(gcstate, generation);
-    if (generation < NUM_GENERATIONS-1)
-        old = GEN_HEAD(gcstate, generation+1);
-    else
-        old = young;
+        /* handy references */
+        young = GEN_HEAD(gcstate, generation);
+        if (generation < NUM_GENERATIONS-1)
+            old = GEN_HEAD(gcstate, generation+1);
+        else
+            old = young;
+    }
     validate_list(old, collecting_clear_unreachable_clear);
 
-    deduce_unreachable(young, &unreachable);
+    Py_ssize_t examined;
+#ifdef GC_PARALLEL
+    if (gcstate->parallel_threads > 1) {
+        examined = deduce_unreachable_parallel(young, &unreachable,
+                                               gcstate->parallel_threads);
+    }
+    else
+#endif
+    {
+        examined = deduce_unreachable(young, &unreachable);
+    }
 
     untrack_tuples(young);
     /* Move reachable objects to next generation. */
@@ -1322,7 +1910,7 @@ gc_collect_main(PyThreadState *tstate, int generation,
 
     /* Clear free list only during the collection of the highest
      * generation */
-    if (generation == NUM_GENERATIONS-1) {
+    if (generation == NUM_GENERATIONS-1 && !incremental) {
         clear_freelists(tstate->interp);
     }
 
@@ -1348,6 +1936,15 @@ gc_collect_main(PyThreadState *tstate, int generation,
     stats->collected += m;
     stats->uncollectable += n;
 
+    if (gcstate->adaptive) {
+        adapt_threshold(gcstate, generation, n + m, examined);
+    }
+
+    if (incremental) {
+        update_incremental_rate(gcstate, n_old,
+                                _PyTime_GetMonotonicClock() - t_start);
+    }
+
     if (PyDTrace_GC_DONE_ENABLED()) {
         PyDTrace_GC_DONE(n + m);
     }
@@ -1405,12 +2002,14 @@ invoke_gc_callback(PyThreadState *tstate, const char *phase,
  * progress callbacks.
  */
 static Py_ssize_t
-gc_collect_with_callback(PyThreadState *tstate, int generation)
+gc_collect_with_callback(PyThreadState *tstate, int generation,
+                         int incremental)
 {
     assert(!_PyErr_Occurred(tstate));
     Py_ssize_t result, collected, uncollectable;
     invoke_gc_callback(tstate, "start", generation, 0, 0);
-    result = gc_collect_main(tstate, generation, &collected, &uncollectable, 0);
+    result = gc_collect_main(tstate, generation, &collected, &uncollectable,
+                             0, incremental);
     invoke_gc_callback(tstate, "stop", generation, collected, uncollectable);
     assert(!_PyErr_Occurred(tstate));
     return result;
@@ -1462,10 +2061,14 @@ gc_collect_generations(PyThreadState *tstate)
                June 2008. His original analysis and proposal can be found at:
                http://mail.python.org/pipermail/python-dev/2008-June/080579.html
             */
-            if (i == NUM_GENERATIONS - 1
+            /* An incremental collection has a bounded cost, so it is not
+               subject to this heuristic. */
+            int incremental = (i == NUM_GENERATIONS - 1
+                               && gcstate->incremental_pause > 0.0);
+            if (i == NUM_GENERATIONS - 1 && !incremental
                 && gcstate->long_lived_pending < gcstate->long_lived_total / 4)
                 continue;
-            n = gc_collect_with_callback(tstate, i);
+            n = gc_collect_with_callback(tstate, i, incremental);
             break;
         }
     }
@@ -1548,7 +2151,7 @@ gc_collect_impl(PyObject *module, int generation)
     }
     else {
         gcstate->collecting = 1;
-        n = gc_collect_with_callback(tstate, generation);
+        n = gc_collect_with_callback(tstate, generation, 0);
         gcstate->collecting = 0;
     }
     return n;
@@ -1605,14 +2208,17 @@ static PyObject *
 gc_set_threshold(PyObject *self, PyObject *args)
 {
     GCState *gcstate = get_gc_state();
+    int *thresholds = gcstate->base_thresholds;
     if (!PyArg_ParseTuple(args, "i|ii:set_threshold",
-                          &gcstate->generations[0].threshold,
-                          &gcstate->generations[1].threshold,
-                          &gcstate->generations[2].threshold))
+                          &thresholds[0], &thresholds[1], &thresholds[2]))
         return NULL;
     for (int i = 3; i < NUM_GENERATIONS; i++) {
         /* generations higher than 2 get the same threshold */
-        gcstate->generations[i].threshold = gcstate->generations[2].threshold;
+        thresholds[i] = thresholds[2];
+    }
+    /* This also resets the thresholds adapted in adaptive mode */
+    for (int i = 0; i < NUM_GENERATIONS; i++) {
+        gcstate->generations[i].threshold = thresholds[i];
     }
     Py_RETURN_NONE;
 }
@@ -1629,9 +2235,9 @@ gc_get_threshold_impl(PyObject *module)
 {
     GCState *gcstate = get_gc_state();
     return Py_BuildValue("(iii)",
-                         gcstate->generations[0].threshold,
-                         gcstate->generations[1].threshold,
-                         gcstate->generations[2].threshold);
+                         gcstate->base_thresholds[0],
+                         gcstate->base_thresholds[1],
+                         gcstate->base_thresholds[2]);
 }
 
 /*[clinic input]
@@ -1823,12 +2429,14 @@ gc_get_stats_impl(PyObject *module)
 {
     int i;
     struct gc_generation_stats stats[NUM_GENERATIONS], *st;
+    int thresholds[NUM_GENERATIONS];
 
     /* To get consistent values despite allocations while constructing
        the result list, we use a snapshot of the running stats. */
     GCState *gcstate = get_gc_state();
     for (i = 0; i < NUM_GENERATIONS; i++) {
         stats[i] = gcstate->generation_stats[i];
+        thresholds[i] = gcstate->generations[i].threshold;
     }
 
     PyObject *result = PyList_New(0);
@@ -1838,10 +2446,11 @@ gc_get_stats_impl(PyObject *module)
     for (i = 0; i < NUM_GENERATIONS; i++) {
         PyObject *dict;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsn}",
+        dict = Py_BuildValue("{snsnsnsi}",
                              "collections", st->collections,
                              "collected", st->collected,
-                             "uncollectable", st->uncollectable
+                             "uncollectable", st->uncollectable,
+                             "threshold", thresholds[i]
                             );
         if (dict == NULL)
             goto error;
@@ -1957,6 +2566,138 @@ gc_get_freeze_count_impl(PyObject *module)
     return gc_list_size(&gcstate->permanent_generation.head);
 }
 
+/*[clinic input]
+gc.set_incremental
+
+    max_pause_ms: double
+
+Make automatic collections of the oldest generation incremental.
+
+Each of them then examines only as many objects of the oldest generation as
+it can in about max_pause_ms milliseconds, starting where the previous one
+stopped.  Reference cycles too large to be examined at once are only freed
+by collect().  A max_pause_ms of 0 restores full collections.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_incremental_impl(PyObject *module, double max_pause_ms)
+/*[clinic end generated code: output=bb4ba51906464219 input=1a175d4565d82bd9]*/
+{
+    if (!(max_pause_ms >= 0.0)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "max_pause_ms must be a non-negative number");
+        return NULL;
+    }
+    GCState *gcstate = get_gc_state();
+    gcstate->incremental_pause = max_pause_ms;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_incremental -> double
+
+Return the pause budget of incremental collections, in milliseconds.
+
+Return 0 if automatic collections of the oldest generation are full ones.
+[clinic start generated code]*/
+
+static double
+gc_get_incremental_impl(PyObject *module)
+/*[clinic end generated code: output=a4ff9b83a08a764e input=36459dfea7cbfdaa]*/
+{
+    GCState *gcstate = get_gc_state();
+    return gcstate->incremental_pause;
+}
+
+/*[clinic input]
+gc.set_adaptive
+
+    enable: bool
+
+Adapt the collection thresholds to the amount of garbage found.
+
+When enabled, the threshold of a generation is raised after a collection
+which found almost no garbage, and lowered back after one which found a
+lot, but never below the one set by set_threshold().  The thresholds in
+use are reported by get_stats().
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_adaptive_impl(PyObject *module, int enable)
+/*[clinic end generated code: output=cb711b8441ee231f input=82ebe3c5b6c060c2]*/
+{
+    GCState *gcstate = get_gc_state();
+    gcstate->adaptive = enable;
+    if (!enable) {
+        for (int i = 0; i < NUM_GENERATIONS; i++) {
+            gcstate->generations[i].threshold = gcstate->base_thresholds[i];
+        }
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_adaptive -> bool
+
+Return true if the collection thresholds are adapted.
+[clinic start generated code]*/
+
+static int
+gc_get_adaptive_impl(PyObject *module)
+/*[clinic end generated code: output=1f7d922ff8e3f6be input=76297311e6d0349f]*/
+{
+    GCState *gcstate = get_gc_state();
+    return gcstate->adaptive;
+}
+
+/*[clinic input]
+gc.set_parallel
+
+    nthreads: int
+
+Set the number of threads used to collect large generations.
+
+Collections examining many objects then split the work between the calling
+thread and nthreads - 1 worker threads.  A value of 1 disables this.  The
+tp_traverse functions of all the tracked objects must then be safe to call
+from a thread not holding the GIL.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_parallel_impl(PyObject *module, int nthreads)
+/*[clinic end generated code: output=1bacc71f0882fbdf input=3daf1164ce1fcd01]*/
+{
+    if (nthreads < 1) {
+        PyErr_SetString(PyExc_ValueError, "nthreads must be at least 1");
+        return NULL;
+    }
+#ifndef GC_PARALLEL
+    if (nthreads > 1) {
+        PyErr_SetString(PyExc_NotImplementedError,
+                        "parallel collection is not supported "
+                        "on this platform");
+        return NULL;
+    }
+#endif
+    GCState *gcstate = get_gc_state();
+    gcstate->parallel_threads = nthreads;
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_parallel -> int
+
+Return the number of threads used to collect large generations.
+[clinic start generated code]*/
+
+static int
+gc_get_parallel_impl(PyObject *module)
+/*[clinic end generated code: output=5b8b3265d5cdfb34 input=2d75c0f9ff23114f]*/
+{
+    GCState *gcstate = get_gc_state();
+    return gcstate->parallel_threads;
+}
+
 
 PyDoc_STRVAR(gc__doc__,
 "This module provides access to the garbage collector for reference cycles.\n"
@@ -1978,7 +2719,13 @@ PyDoc_STRVAR(gc__doc__,
 "get_referents() -- Return the list of objects that an object refers to.\n"
 "freeze() -- Freeze all tracked objects and ignore them for future collections.\n"
 "unfreeze() -- Unfreeze all objects in the permanent generation.\n"
-"get_freeze_count() -- Return the number of objects in the permanent generation.\n");
+"get_freeze_count() -- Return the number of objects in the permanent generation.\n"
+"set_incremental() -- Make automatic collections of the oldest generation incremental.\n"
+"get_incremental() -- Return the pause budget of incremental collections.\n"
+"set_adaptive() -- Adapt the collection thresholds to the amount of garbage found.\n"
+"get_adaptive() -- Return true if the collection thresholds are adapted.\n"
+"set_parallel() -- Set the number of threads used to collect large generations.\n"
+"get_parallel() -- Return the number of threads used to collect large generations.\n");
 
 static PyMethodDef GcMethods[] = {
     GC_ENABLE_METHODDEF
@@ -2001,6 +2748,12 @@ static PyMethodDef GcMethods[] = {
     GC_FREEZE_METHODDEF
     GC_UNFREEZE_METHODDEF
     GC_GET_FREEZE_COUNT_METHODDEF
+    GC_SET_INCREMENTAL_METHODDEF
+    GC_GET_INCREMENTAL_METHODDEF
+    GC_SET_ADAPTIVE_METHODDEF
+    GC_GET_ADAPTIVE_METHODDEF
+    GC_SET_PARALLEL_METHODDEF
+    GC_GET_PARALLEL_METHODDEF
     {NULL,      NULL}           /* Sentinel */
 };
 
@@ -2096,7 +2849,7 @@ PyGC_Collect(void)
         PyObject *exc, *value, *tb;
         gcstate->collecting = 1;
         _PyErr_Fetch(tstate, &exc, &value, &tb);
-        n = gc_collect_with_callback(tstate, NUM_GENERATIONS - 1);
+        n = gc_collect_with_callback(tstate, NUM_GENERATIONS - 1, 0);
         _PyErr_Restore(tstate, exc, value, tb);
         gcstate->collecting = 0;
     }
@@ -2120,7 +2873,7 @@ _PyGC_CollectNoFail(PyThreadState *tstate)
 
     Py_ssize_t n;
     gcstate->collecting = 1;
-    n = gc_collect_main(tstate, NUM_GENERATIONS - 1, NULL, NULL, 1);
+    n = gc_collect_main(tstate, NUM_GENERATIONS - 1, NULL, NULL, 1, 0);
     gcstate->collecting = 0;
     return n;
 }
@@ -1539,6 +1539,15 @@ calculate_path(PyCalculatePath *calculate, _PyPathConfig *pathconfig)
         }
     }
 
+    if (pathconfig->stdlib_dir == NULL && calculate->prefix_found) {
+        /* Before being reduced, the prefix is the directory of LANDMARK,
+           in the build directory too (prefix_found < 0) */
+        pathconfig->stdlib_dir = _PyMem_RawWcsdup(calculate->prefix);
+        if (pathconfig->stdlib_dir == NULL) {
+            return _PyStatus_NO_MEMORY();
+        }
+    }
+
     if (pathconfig->prefix == NULL) {
         status = calculate_set_prefix(calculate, pathconfig);
         if (_PyStatus_EXCEPTION(status)) {
@@ -1584,6 +1593,7 @@ calculate_path(PyCalculatePath *calculate, _PyPathConfig *pathconfig)
    - module_search_path
    - prefix
    - exec_prefix
+   - stdlib_dir
 
    If a field is already set (non NULL), it is left unchanged. */
 PyStatus
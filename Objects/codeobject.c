@@ -114,12 +114,14 @@ intern_string_constants(PyObject *tuple, int *modified)
 }
 
 PyCodeObject *
-PyCode_NewWithPosOnlyArgs(int argcount, int posonlyargcount, int kwonlyargcount,
-                          int nlocals, int stacksize, int flags,
-                          PyObject *code, PyObject *consts, PyObject *names,
-                          PyObject *varnames, PyObject *freevars, PyObject *cellvars,
-                          PyObject *filename, PyObject *name, int firstlineno,
-                          PyObject *linetable)
+_PyCode_NewWithExceptionTable(int argcount, int posonlyargcount,
+                              int kwonlyargcount, int nlocals, int stacksize,
+                              int flags, PyObject *code, PyObject *consts,
+                              PyObject *names, PyObject *varnames,
+                              PyObject *freevars, PyObject *cellvars,
+                              PyObject *filename, PyObject *name,
+                              int firstlineno, PyObject *linetable,
+                              PyObject *exceptiontable)
 {
     PyCodeObject *co;
     Py_ssize_t *cell2arg = NULL;
@@ -137,7 +139,8 @@ PyCode_NewWithPosOnlyArgs(int argcount, int posonlyargcount, int kwonlyargcount,
         cellvars == NULL || !PyTuple_Check(cellvars) ||
         name == NULL || !PyUnicode_Check(name) ||
         filename == NULL || !PyUnicode_Check(filename) ||
-        linetable == NULL || !PyBytes_Check(linetable)) {
+        linetable == NULL || !PyBytes_Check(linetable) ||
+        (exceptiontable != NULL && !PyBytes_Check(exceptiontable))) {
         PyErr_BadInternalCall();
         return NULL;
     }
@@ -228,10 +231,22 @@ PyCode_NewWithPosOnlyArgs(int argcount, int posonlyargcount, int kwonlyargcount,
             cell2arg = NULL;
         }
     }
+    if (exceptiontable == NULL) {
+        exceptiontable = PyBytes_FromStringAndSize(NULL, 0);
+        if (exceptiontable == NULL) {
+            if (cell2arg)
+                PyMem_Free(cell2arg);
+            return NULL;
+        }
+    }
+    else {
+        Py_INCREF(exceptiontable);
+    }
     co = PyObject_New(PyCodeObject, &PyCode_Type);
     if (co == NULL) {
         if (cell2arg)
             PyMem_Free(cell2arg);
+        Py_DECREF(exceptiontable);
         return NULL;
     }
     co->co_argcount = argcount;
@@ -260,6 +275,7 @@ PyCode_NewWithPosOnlyArgs(int argcount, int posonlyargcount, int kwonlyargcount,
     co->co_firstlineno = firstlineno;
     Py_INCREF(linetable);
     co->co_linetable = linetable;
+    co->co_exceptiontable = exceptiontable;
     co->co_zombieframe = NULL;
     co->co_weakreflist = NULL;
     co->co_extra = NULL;
@@ -268,9 +284,26 @@ PyCode_NewWithPosOnlyArgs(int argcount, int posonlyargcount, int kwonlyargcount,
     co->co_opcache = NULL;
     co->co_opcache_flag = 0;
     co->co_opcache_size = 0;
+    co->co_opcache_stats = NULL;
+    co->co_quickened = NULL;
     return co;
 }
 
+PyCodeObject *
+PyCode_NewWithPosOnlyArgs(int argcount, int posonlyargcount, int kwonlyargcount,
+                          int nlocals, int stacksize, int flags,
+                          PyObject *code, PyObject *consts, PyObject *names,
+                          PyObject *varnames, PyObject *freevars, PyObject *cellvars,
+                          PyObject *filename, PyObject *name, int firstlineno,
+                          PyObject *linetable)
+{
+    return _PyCode_NewWithExceptionTable(argcount, posonlyargcount,
+                                         kwonlyargcount, nlocals, stacksize,
+                                         flags, code, consts, names, varnames,
+                                         freevars, cellvars, filename, name,
+                                         firstlineno, linetable, NULL);
+}
+
 PyCodeObject *
 PyCode_New(int argcount, int kwonlyargcount,
            int nlocals, int stacksize, int flags,
@@ -302,7 +335,10 @@ _PyCode_InitOpcache(PyCodeObject *co)
         i++;  // 'i' is now aligned to (next_instr - first_instr)
 
         // TODO: LOAD_METHOD
-        if (opcode == LOAD_GLOBAL || opcode == LOAD_ATTR) {
+        if (opcode == LOAD_GLOBAL || opcode == LOAD_ATTR ||
+            opcode == STORE_ATTR || opcode == BINARY_SUBSCR ||
+            opcode == CALL_FUNCTION)
+        {
             opts++;
             co->co_opcache_map[i] = (unsigned char)opts;
             if (opts > 254) {
@@ -328,6 +364,110 @@ _PyCode_InitOpcache(PyCodeObject *co)
     return 0;
 }
 
+/* Return the superinstruction replacing 'first' when it is followed by
+   'second', or 0 if the pair has none. */
+static int
+superinstruction(int first, int second)
+{
+    switch (first) {
+    case LOAD_FAST:
+        switch (second) {
+        case LOAD_FAST:
+            return LOAD_FAST__LOAD_FAST;
+        case LOAD_CONST:
+            return LOAD_FAST__LOAD_CONST;
+        case LOAD_ATTR:
+            return LOAD_FAST__LOAD_ATTR;
+        }
+        break;
+    case LOAD_CONST:
+        switch (second) {
+        case LOAD_FAST:
+            return LOAD_CONST__LOAD_FAST;
+        case RETURN_VALUE:
+            return LOAD_CONST__RETURN_VALUE;
+        }
+        break;
+    case STORE_FAST:
+        switch (second) {
+        case LOAD_FAST:
+            return STORE_FAST__LOAD_FAST;
+        case STORE_FAST:
+            return STORE_FAST__STORE_FAST;
+        }
+        break;
+    }
+    return 0;
+}
+
+/* Create co_quickened: a copy of co_code in which the first instruction of
+   each common pair is replaced with the matching superinstruction (see
+   ceval.c).  The second instruction is kept as is, since it may be a jump
+   target, and is not itself the start of another pair.  An instruction
+   following EXTENDED_ARG is never the second of a pair, as the
+   superinstruction only reads its one-byte argument. */
+int
+_PyCode_Quicken(PyCodeObject *co)
+{
+    assert(co->co_quickened == NULL);
+    Py_ssize_t size = PyBytes_GET_SIZE(co->co_code);
+    const unsigned char *code = (const unsigned char *)PyBytes_AS_STRING(co->co_code);
+    unsigned char *quickened = PyMem_Malloc(size);
+    if (quickened == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    memcpy(quickened, code, size);
+
+    // Each code unit is an opcode byte followed by an argument byte.
+    for (Py_ssize_t i = 0; i + 2 < size; i += 2) {
+        int op = superinstruction(code[i], code[i + 2]);
+        if (op) {
+            quickened[i] = (unsigned char)op;
+            i += 2;
+        }
+    }
+    co->co_quickened = (_Py_CODEUNIT *)quickened;
+    return 0;
+}
+
+/* Lazy code constants are only ever replaced by the code object they stand
+   for, so co_consts keeps the same value even though it is mutated. */
+PyObject *
+_PyCode_LoadLazyConst(PyCodeObject *co, PyObject *lazy)
+{
+    PyObject *code = _PyLazyCode_Load(lazy);
+    if (code == NULL) {
+        return NULL;
+    }
+    PyObject **items = _PyTuple_ITEMS(co->co_consts);
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(co->co_consts); i++) {
+        if (items[i] == lazy) {
+            Py_INCREF(code);
+            items[i] = code;
+            Py_DECREF(lazy);
+            break;
+        }
+    }
+    return code;
+}
+
+int
+_PyCode_LoadLazyConsts(PyCodeObject *co)
+{
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(co->co_consts); i++) {
+        PyObject *item = PyTuple_GET_ITEM(co->co_consts, i);
+        if (_PyLazyCode_Check(item)) {
+            PyObject *code = _PyCode_LoadLazyConst(co, item);
+            if (code == NULL) {
+                return -1;
+            }
+            Py_DECREF(code);
+        }
+    }
+    return 0;
+}
+
 PyCodeObject *
 PyCode_NewEmpty(const char *filename, const char *funcname, int firstlineno)
 {
@@ -388,7 +528,6 @@ static PyMemberDef code_memberlist[] = {
     {"co_stacksize",T_INT,              OFF(co_stacksize),       READONLY},
     {"co_flags",        T_INT,          OFF(co_flags),           READONLY},
     {"co_code",         T_OBJECT,       OFF(co_code),            READONLY},
-    {"co_consts",       T_OBJECT,       OFF(co_consts),          READONLY},
     {"co_names",        T_OBJECT,       OFF(co_names),           READONLY},
     {"co_varnames",     T_OBJECT,       OFF(co_varnames),        READONLY},
     {"co_freevars",     T_OBJECT,       OFF(co_freevars),        READONLY},
@@ -397,6 +536,7 @@ static PyMemberDef code_memberlist[] = {
     {"co_name",         T_OBJECT,       OFF(co_name),            READONLY},
     {"co_firstlineno",  T_INT,          OFF(co_firstlineno),     READONLY},
     {"co_linetable",    T_OBJECT,       OFF(co_linetable),       READONLY},
+    {"co_exceptiontable", T_OBJECT,     OFF(co_exceptiontable),  READONLY},
     {NULL}      /* Sentinel */
 };
 
@@ -472,7 +612,18 @@ code_getlnotab(PyCodeObject *code, void *closure)
 }
 
 
+static PyObject *
+code_getconsts(PyCodeObject *code, void *closure)
+{
+    if (_PyCode_LoadLazyConsts(code) < 0) {
+        return NULL;
+    }
+    Py_INCREF(code->co_consts);
+    return code->co_consts;
+}
+
 static PyGetSetDef code_getsetlist[] = {
+    {"co_consts",    (getter)code_getconsts, NULL, NULL},
     {"co_lnotab",    (getter)code_getlnotab, NULL, NULL},
     {0}
 };
@@ -540,6 +691,7 @@ code.__new__ as code_new
     linetable: object(subclass_of="&PyBytes_Type")
     freevars: object(subclass_of="&PyTuple_Type", c_default="NULL") = ()
     cellvars: object(subclass_of="&PyTuple_Type", c_default="NULL") = ()
+    exceptiontable: object(subclass_of="&PyBytes_Type", c_default="NULL") = b''
     /
 
 Create a code object.  Not for the faint of heart.
@@ -551,8 +703,8 @@ code_new_impl(PyTypeObject *type, int argcount, int posonlyargcount,
               PyObject *code, PyObject *consts, PyObject *names,
               PyObject *varnames, PyObject *filename, PyObject *name,
               int firstlineno, PyObject *linetable, PyObject *freevars,
-              PyObject *cellvars)
-/*[clinic end generated code: output=42c1839b082ba293 input=0ec80da632b99f57]*/
+              PyObject *cellvars, PyObject *exceptiontable)
+/*[clinic end generated code: output=a25443d0f19621da input=630aee2b84bdc947]*/
 {
     PyObject *co = NULL;
     PyObject *ournames = NULL;
@@ -612,13 +764,14 @@ code_new_impl(PyTypeObject *type, int argcount, int posonlyargcount,
     if (ourcellvars == NULL)
         goto cleanup;
 
-    co = (PyObject *)PyCode_NewWithPosOnlyArgs(argcount, posonlyargcount,
-                                               kwonlyargcount,
-                                               nlocals, stacksize, flags,
-                                               code, consts, ournames,
-                                               ourvarnames, ourfreevars,
-                                               ourcellvars, filename,
-                                               name, firstlineno, linetable);
+    co = (PyObject *)_PyCode_NewWithExceptionTable(argcount, posonlyargcount,
+                                                   kwonlyargcount,
+                                                   nlocals, stacksize, flags,
+                                                   code, consts, ournames,
+                                                   ourvarnames, ourfreevars,
+                                                   ourcellvars, filename,
+                                                   name, firstlineno, linetable,
+                                                   exceptiontable);
   cleanup:
     Py_XDECREF(ournames);
     Py_XDECREF(ourvarnames);
@@ -638,6 +791,12 @@ code_dealloc(PyCodeObject *co)
     }
     co->co_opcache_flag = 0;
     co->co_opcache_size = 0;
+    if (co->co_opcache_stats != NULL) {
+        PyMem_Free(co->co_opcache_stats);
+    }
+    if (co->co_quickened != NULL) {
+        PyMem_Free(co->co_quickened);
+    }
 
     if (co->co_extra != NULL) {
         PyInterpreterState *interp = _PyInterpreterState_GET();
@@ -663,9 +822,11 @@ code_dealloc(PyCodeObject *co)
     Py_XDECREF(co->co_filename);
     Py_XDECREF(co->co_name);
     Py_XDECREF(co->co_linetable);
+    Py_XDECREF(co->co_exceptiontable);
     if (co->co_cell2arg != NULL)
         PyMem_Free(co->co_cell2arg);
-    if (co->co_zombieframe != NULL)
+    if (co->co_zombieframe != NULL &&
+        co->co_zombieframe != _PyCode_ZOMBIE_IN_USE)
         PyObject_GC_Del(co->co_zombieframe);
     if (co->co_weakreflist != NULL)
         PyObject_ClearWeakRefs((PyObject*)co);
@@ -692,6 +853,9 @@ code_sizeof(PyCodeObject *co, PyObject *Py_UNUSED(args))
         // co_opcache
         res += co->co_opcache_size * sizeof(_PyOpcache);
     }
+    if (co->co_quickened != NULL) {
+        res += PyBytes_GET_SIZE(co->co_code);
+    }
     return PyLong_FromSsize_t(res);
 }
 
@@ -715,6 +879,7 @@ code.replace
     co_filename: unicode(c_default="self->co_filename") = None
     co_name: unicode(c_default="self->co_name") = None
     co_linetable: PyBytesObject(c_default="(PyBytesObject *)self->co_linetable") = None
+    co_exceptiontable: PyBytesObject(c_default="(PyBytesObject *)self->co_exceptiontable") = None
 
 Return a copy of the code object with new values for the specified fields.
 [clinic start generated code]*/
@@ -727,8 +892,9 @@ code_replace_impl(PyCodeObject *self, int co_argcount,
                   PyObject *co_consts, PyObject *co_names,
                   PyObject *co_varnames, PyObject *co_freevars,
                   PyObject *co_cellvars, PyObject *co_filename,
-                  PyObject *co_name, PyBytesObject *co_linetable)
-/*[clinic end generated code: output=50d77e668d3b449b input=a5f997b173d7f636]*/
+                  PyObject *co_name, PyBytesObject *co_linetable,
+                  PyBytesObject *co_exceptiontable)
+/*[clinic end generated code: output=80957472b7f78ed6 input=38376b1193efbbae]*/
 {
 #define CHECK_INT_ARG(ARG) \
         if (ARG < 0) { \
@@ -754,11 +920,12 @@ code_replace_impl(PyCodeObject *self, int co_argcount,
         return NULL;
     }
 
-    return (PyObject *)PyCode_NewWithPosOnlyArgs(
+    return (PyObject *)_PyCode_NewWithExceptionTable(
         co_argcount, co_posonlyargcount, co_kwonlyargcount, co_nlocals,
         co_stacksize, co_flags, (PyObject*)co_code, co_consts, co_names,
         co_varnames, co_freevars, co_cellvars, co_filename, co_name,
-        co_firstlineno, (PyObject*)co_linetable);
+        co_firstlineno, (PyObject*)co_linetable,
+        (PyObject*)co_exceptiontable);
 }
 
 static PyObject *
@@ -943,8 +1110,14 @@ code_richcompare(PyObject *self, PyObject *other, int op)
     if (!eq) goto unequal;
     eq = PyObject_RichCompareBool(co->co_code, cp->co_code, Py_EQ);
     if (eq <= 0) goto unequal;
+    eq = PyObject_RichCompareBool(co->co_exceptiontable,
+                                  cp->co_exceptiontable, Py_EQ);
+    if (eq <= 0) goto unequal;
 
     /* compare constants */
+    if (_PyCode_LoadLazyConsts(co) < 0 || _PyCode_LoadLazyConsts(cp) < 0) {
+        return NULL;
+    }
     consts1 = _PyCode_ConstantKey(co->co_consts);
     if (!consts1)
         return NULL;
@@ -994,6 +1167,7 @@ code_hash(PyCodeObject *co)
     if (h0 == -1) return -1;
     h1 = PyObject_Hash(co->co_code);
     if (h1 == -1) return -1;
+    if (_PyCode_LoadLazyConsts(co) < 0) return -1;
     h2 = PyObject_Hash(co->co_consts);
     if (h2 == -1) return -1;
     h3 = PyObject_Hash(co->co_names);
@@ -1238,6 +1412,68 @@ PyTypeObject PyCode_Type = {
     code_new,                           /* tp_new */
 };
 
+/* Read co_exceptiontable.  See exception_handling_notes.txt for the details
+   of its representation.
+*/
+
+static int
+read_varint(const unsigned char *p, Py_ssize_t size, Py_ssize_t *pos, int *value)
+{
+    unsigned int result = 0;
+    int shift = 0;
+    while (*pos < size && shift < 32) {
+        unsigned char byte = p[(*pos)++];
+        result |= (unsigned int)(byte & 127) << shift;
+        if (!(byte & 128)) {
+            if (result > INT_MAX) {
+                return -1;
+            }
+            *value = (int)result;
+            return 0;
+        }
+        shift += 7;
+    }
+    return -1;
+}
+
+int
+_PyCode_ReadExceptionTableEntry(PyObject *table, Py_ssize_t *pos,
+                                _PyExceptionTableEntry *entry)
+{
+    const unsigned char *p = (const unsigned char *)PyBytes_AS_STRING(table);
+    Py_ssize_t size = PyBytes_GET_SIZE(table);
+    int length;
+
+    if (*pos >= size) {
+        return 0;
+    }
+    if (read_varint(p, size, pos, &entry->start) < 0 ||
+        read_varint(p, size, pos, &length) < 0 ||
+        read_varint(p, size, pos, &entry->handler) < 0 ||
+        read_varint(p, size, pos, &entry->level) < 0 ||
+        length > INT_MAX - entry->start) {
+        return -1;
+    }
+    entry->end = entry->start + length;
+    return 1;
+}
+
+int
+_PyCode_FindExceptionHandler(PyCodeObject *co, int offset,
+                             _PyExceptionTableEntry *entry)
+{
+    Py_ssize_t pos = 0;
+    /* Entries are sorted and don't overlap: the first one that ends after
+       offset is the only one that may cover it. */
+    while (_PyCode_ReadExceptionTableEntry(co->co_exceptiontable, &pos,
+                                           entry) > 0) {
+        if (offset < entry->end) {
+            return offset >= entry->start;
+        }
+    }
+    return 0;
+}
+
 /* Use co_linetable to compute the line number from a bytecode index, addrq.  See
    lnotab_notes.txt for the details of the lnotab representation.
 */
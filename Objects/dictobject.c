@@ -1475,6 +1475,48 @@ _PyDict_GetItemHint(PyDictObject *mp, PyObject *key,
     return (mp->ma_keys->dk_lookup)(mp, key, hash, value);
 }
 
+/* Replace the value of an existing str key found at entry index 'hint',
+   without doing a lookup.  Used by the STORE_ATTR opcode cache.
+   Return 0 on success, or -1 (without an exception set) if 'hint' doesn't
+   point at 'key'; the dict is left unchanged in that case.
+*/
+int
+_PyDict_SetItemHint(PyDictObject *mp, PyObject *key,
+                    Py_ssize_t hint, PyObject *value)
+{
+    assert(PyDict_CheckExact((PyObject*)mp));
+    assert(PyUnicode_CheckExact(key));
+    assert(value != NULL);
+
+    if (hint < 0 || hint >= mp->ma_keys->dk_nentries) {
+        return -1;
+    }
+    PyDictKeyEntry *ep = DK_ENTRIES(mp->ma_keys) + (size_t)hint;
+    if (ep->me_key != key) {
+        return -1;
+    }
+
+    PyObject **slot;
+    if (_PyDict_HasSplitTable(mp)) {
+        slot = &mp->ma_values[(size_t)hint];
+    }
+    else {
+        slot = &ep->me_value;
+    }
+    PyObject *old_value = *slot;
+    if (old_value == NULL) {
+        return -1;
+    }
+
+    MAINTAIN_TRACKING(mp, key, value);
+    Py_INCREF(value);
+    *slot = value;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
+    ASSERT_CONSISTENT(mp);
+    Py_DECREF(old_value); /* which **CAN** re-enter (see issue #22653) */
+    return 0;
+}
+
 /* Same as PyDict_GetItemWithError() but with hash supplied by caller.
    This returns NULL *with* an exception set if an exception occurred.
    It returns NULL *without* an exception set if the key wasn't present.
@@ -2,8 +2,10 @@
 
 #include "Python.h"
 #include "pycore_ceval.h"         // _PyEval_BuiltinsFromGlobals()
+#include "pycore_code.h"          // _PyCode_ReadExceptionTableEntry()
 #include "pycore_moduleobject.h"  // _PyModule_GetDict()
 #include "pycore_object.h"        // _PyObject_GC_UNTRACK()
+#include "pycore_pylifecycle.h"   // _PyFrame_ClearChunks()
 
 #include "frameobject.h"          // PyFrameObject
 #include "opcode.h"               // EXTENDED_ARG
@@ -114,8 +116,95 @@ top_block(int64_t stack)
     return stack & ((1<<BITS_PER_BLOCK)-1);
 }
 
+/* Return an array giving, for each instruction, the offset of the innermost
+   exception handler covering it, or -1.  It is followed by an array giving
+   the stack level of each handler, indexed by the handler offset.  A
+   handler is nested in the handler covering its own first instruction,
+   as that is the handler active where the try statement starts. */
+static int *
+markhandlers(PyCodeObject *code_obj, int len)
+{
+    int *handlers = PyMem_New(int, 2*(len+1));
+    if (handlers == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    for (int i = 0; i < 2*(len+1); i++) {
+        handlers[i] = -1;
+    }
+    int *levels = handlers + len + 1;
+    Py_ssize_t pos = 0;
+    _PyExceptionTableEntry entry;
+    while (_PyCode_ReadExceptionTableEntry(code_obj->co_exceptiontable,
+                                           &pos, &entry) > 0) {
+        if (entry.handler >= len || entry.end > len) {
+            continue;
+        }
+        for (int i = entry.start; i < entry.end; i++) {
+            handlers[i] = entry.handler;
+        }
+        levels[entry.handler] = entry.level;
+    }
+    return handlers;
+}
+
+/* Fill chain with the handlers active where handler is the innermost one,
+   innermost first, and return their number. */
+static int
+handler_chain(const int *handlers, int handler, int *chain)
+{
+    int n = 0;
+    while (handler >= 0 && n < CO_MAXBLOCKS) {
+        chain[n++] = handler;
+        handler = handlers[handler];
+    }
+    return n;
+}
+
+/* Update the block stack for the flow from an instruction whose innermost
+   handler is from to one whose innermost handler is to, leaving and
+   entering try and with statements.  The handlers of the statements
+   entered get the block stack they run with. */
+static int64_t
+change_handlers(int64_t *blocks, const _Py_CODEUNIT *code,
+                const int *handlers, int i, int64_t stack,
+                int from, int to, int *todo)
+{
+    int from_chain[CO_MAXBLOCKS], to_chain[CO_MAXBLOCKS];
+    int nfrom, nto;
+
+    if (from == to) {
+        return stack;
+    }
+    nfrom = handler_chain(handlers, from, from_chain);
+    nto = handler_chain(handlers, to, to_chain);
+    while (nfrom > 0 && nto > 0 &&
+           from_chain[nfrom-1] == to_chain[nto-1]) {
+        nfrom--;
+        nto--;
+    }
+    while (nfrom-- > 0 && stack > 0) {
+        stack = pop_block(stack);
+    }
+    while (nto-- > 0) {
+        int handler = to_chain[nto];
+        int64_t except_stack = push_block(stack, Except);
+        if (blocks[handler] == -1 && handler < i) {
+            *todo = 1;
+        }
+        blocks[handler] = except_stack;
+        if (_Py_OPCODE(code[handler]) == WITH_EXCEPT_START) {
+            stack = push_block(stack, With);
+        }
+        else {
+            stack = push_block(stack, Try);
+        }
+    }
+    return stack;
+}
+
 static int64_t *
-markblocks(PyCodeObject *code_obj, int len)
+markblocks(PyCodeObject *code_obj, int len, const int *handlers)
 {
     const _Py_CODEUNIT *code =
         (const _Py_CODEUNIT *)PyBytes_AS_STRING(code_obj->co_code);
@@ -127,13 +216,15 @@ markblocks(PyCodeObject *code_obj, int len)
         return NULL;
     }
     memset(blocks, -1, (len+1)*sizeof(int64_t));
-    blocks[0] = 0;
-    int todo = 1;
+    int todo = 0;
+    blocks[0] = change_handlers(blocks, code, handlers, 0, 0,
+                                -1, handlers[0], &todo);
+    todo = 1;
     while (todo) {
         todo = 0;
         for (i = 0; i < len; i++) {
             int64_t block_stack = blocks[i];
-            int64_t except_stack;
+            int64_t target_stack;
             if (block_stack == -1) {
                 continue;
             }
@@ -149,9 +240,11 @@ markblocks(PyCodeObject *code_obj, int len)
                     if (blocks[j] == -1 && j < i) {
                         todo = 1;
                     }
-                    assert(blocks[j] == -1 || blocks[j] == block_stack);
-                    blocks[j] = block_stack;
-                    blocks[i+1] = block_stack;
+                    target_stack = change_handlers(blocks, code, handlers, i,
+                                                   block_stack, handlers[i],
+                                                   handlers[j], &todo);
+                    assert(blocks[j] == -1 || blocks[j] == target_stack);
+                    blocks[j] = target_stack;
                     break;
                 case JUMP_ABSOLUTE:
                     j = get_arg(code, i);
@@ -159,64 +252,54 @@ markblocks(PyCodeObject *code_obj, int len)
                     if (blocks[j] == -1 && j < i) {
                         todo = 1;
                     }
-                    assert(blocks[j] == -1 || blocks[j] == block_stack);
-                    blocks[j] = block_stack;
-                    break;
-                case SETUP_FINALLY:
-                    j = get_arg(code, i) + i + 1;
-                    assert(j < len);
-                    except_stack = push_block(block_stack, Except);
-                    assert(blocks[j] == -1 || blocks[j] == except_stack);
-                    blocks[j] = except_stack;
-                    block_stack = push_block(block_stack, Try);
-                    blocks[i+1] = block_stack;
-                    break;
-                case SETUP_WITH:
-                case SETUP_ASYNC_WITH:
-                    j = get_arg(code, i) + i + 1;
-                    assert(j < len);
-                    except_stack = push_block(block_stack, Except);
-                    assert(blocks[j] == -1 || blocks[j] == except_stack);
-                    blocks[j] = except_stack;
-                    block_stack = push_block(block_stack, With);
-                    blocks[i+1] = block_stack;
+                    target_stack = change_handlers(blocks, code, handlers, i,
+                                                   block_stack, handlers[i],
+                                                   handlers[j], &todo);
+                    assert(blocks[j] == -1 || blocks[j] == target_stack);
+                    blocks[j] = target_stack;
+                    block_stack = -1;
                     break;
                 case JUMP_FORWARD:
                     j = get_arg(code, i) + i + 1;
                     assert(j < len);
-                    assert(blocks[j] == -1 || blocks[j] == block_stack);
-                    blocks[j] = block_stack;
+                    target_stack = change_handlers(blocks, code, handlers, i,
+                                                   block_stack, handlers[i],
+                                                   handlers[j], &todo);
+                    assert(blocks[j] == -1 || blocks[j] == target_stack);
+                    blocks[j] = target_stack;
+                    block_stack = -1;
                     break;
                 case GET_ITER:
                 case GET_AITER:
                     block_stack = push_block(block_stack, Loop);
-                    blocks[i+1] = block_stack;
                     break;
                 case FOR_ITER:
-                    blocks[i+1] = block_stack;
-                    block_stack = pop_block(block_stack);
                     j = get_arg(code, i) + i + 1;
                     assert(j < len);
-                    assert(blocks[j] == -1 || blocks[j] == block_stack);
-                    blocks[j] = block_stack;
+                    target_stack = change_handlers(blocks, code, handlers, i,
+                                                   pop_block(block_stack),
+                                                   handlers[i], handlers[j],
+                                                   &todo);
+                    assert(blocks[j] == -1 || blocks[j] == target_stack);
+                    blocks[j] = target_stack;
                     break;
-                case POP_BLOCK:
                 case POP_EXCEPT:
                     block_stack = pop_block(block_stack);
-                    blocks[i+1] = block_stack;
                     break;
                 case END_ASYNC_FOR:
                     block_stack = pop_block(pop_block(block_stack));
-                    blocks[i+1] = block_stack;
                     break;
                 case RETURN_VALUE:
                 case RAISE_VARARGS:
                 case RERAISE:
                     /* End of block */
+                    block_stack = -1;
                     break;
-                default:
-                    blocks[i+1] = block_stack;
-
+            }
+            if (block_stack != -1) {
+                blocks[i+1] = change_handlers(blocks, code, handlers, i,
+                                              block_stack, handlers[i],
+                                              handlers[i+1], &todo);
             }
         }
     }
@@ -300,16 +383,11 @@ frame_stack_pop(PyFrameObject *f)
 }
 
 static void
-frame_block_unwind(PyFrameObject *f)
+frame_stack_unwind(PyFrameObject *f, int level)
 {
     assert(f->f_stackdepth >= 0);
-    assert(f->f_iblock > 0);
-    f->f_iblock--;
-    PyTryBlock *b = &f->f_blockstack[f->f_iblock];
-    intptr_t delta = f->f_stackdepth - b->b_level;
-    while (delta > 0) {
+    while (f->f_stackdepth > level) {
         frame_stack_pop(f);
-        delta--;
     }
 }
 
@@ -327,7 +405,7 @@ frame_block_unwind(PyFrameObject *f)
  *    we cannot be sure which state the interpreter was in or would be in
  *    during execution of the finally block.
  *  o 'try', 'with' and 'async with' blocks can't be jumped into because
- *    the blockstack needs to be set up before their code runs.
+ *    their handlers expect the stack of the statement.
  *  o 'for' and 'async for' loops can't be jumped into because the
  *    iterator needs to be on the stack.
  *  o Jumps cannot be made from within a trace function invoked with a
@@ -422,8 +500,14 @@ frame_setlineno(PyFrameObject *f, PyObject* p_new_lineno, void *Py_UNUSED(ignore
         return -1;
     }
 
-    int64_t *blocks = markblocks(f->f_code, len);
+    int *handlers = markhandlers(f->f_code, len);
+    if (handlers == NULL) {
+        PyMem_Free(lines);
+        return -1;
+    }
+    int64_t *blocks = markblocks(f->f_code, len, handlers);
     if (blocks == NULL) {
+        PyMem_Free(handlers);
         PyMem_Free(lines);
         return -1;
     }
@@ -456,10 +540,17 @@ frame_setlineno(PyFrameObject *f, PyObject* p_new_lineno, void *Py_UNUSED(ignore
     PyMem_Free(blocks);
     PyMem_Free(lines);
     if (msg != NULL) {
+        PyMem_Free(handlers);
         PyErr_SetString(PyExc_ValueError, msg);
         return -1;
     }
 
+    /* The try and with statements left, innermost first */
+    int chain[CO_MAXBLOCKS];
+    int nchain = handler_chain(handlers, handlers[f->f_lasti], chain);
+    int *levels = handlers + len + 1;
+    int ichain = 0;
+
     /* Unwind block stack. */
     while (start_block_stack > best_block_stack) {
         Kind kind = top_block(start_block_stack);
@@ -468,20 +559,26 @@ frame_setlineno(PyFrameObject *f, PyObject* p_new_lineno, void *Py_UNUSED(ignore
             frame_stack_pop(f);
             break;
         case Try:
-            frame_block_unwind(f);
+            if (ichain < nchain) {
+                frame_stack_unwind(f, levels[chain[ichain++]]);
+            }
             break;
         case With:
-            frame_block_unwind(f);
+            if (ichain < nchain) {
+                frame_stack_unwind(f, levels[chain[ichain++]]);
+            }
             // Pop the exit function
             frame_stack_pop(f);
             break;
         case Except:
+            PyMem_Free(handlers);
             PyErr_SetString(PyExc_ValueError,
                 "can't jump out of an 'except' block");
             return -1;
         }
         start_block_stack = pop_block(start_block_stack);
     }
+    PyMem_Free(handlers);
 
     /* Finally set the new f_lasti and return OK. */
     f->f_lineno = 0;
@@ -564,10 +661,177 @@ static PyGetSetDef frame_getsetlist[] = {
    Later, PyFrame_MAXFREELIST was added to bound the # of frames saved on
    free_list.  Else programs creating lots of cyclic trash involving
    frames could provoke free_list into growing without bound.
+
+   3. Beyond the depth the free list can serve, frames of deep recursion
+   are allocated from a stack of memory chunks owned by the calling thread
+   (tstate->frame_chunk) rather than with malloc(): the frames of a deep
+   call chain are then contiguous in memory and allocating one is a
+   pointer bump.  This is only done when the zombie frame of the code
+   object is in use, so that a frame allocated on the heap is still there
+   to become the zombie; co_zombieframe is _PyCode_ZOMBIE_IN_USE meanwhile.
+   Frames of generators and coroutines, which outlive the call creating
+   them, are not allocated on the stack.  A frame that escapes its call
+   (sys._getframe(), tracebacks) keeps its place until it is deallocated;
+   frames allocated after it simply go above it, and the top of the chunk
+   moves back below it once it is freed.  Frames allocated on the stack are
+   released when deallocated, they never become zombies nor go to the free
+   list.  Chunks left empty are kept for reuse until the free lists are
+   cleared.
 */
 /* max value for numfree */
 #define PyFrame_MAXFREELIST 200
 
+/* Size of the chunks of memory frames are allocated from.  Frames larger
+   than a quarter of it are allocated like other objects. */
+#define FRAME_CHUNK_SIZE (64 * 1024)
+#define FRAME_ALIGNMENT 16
+
+/* Header of each frame allocated in a chunk, followed by its PyGC_Head */
+typedef struct _frame_slot {
+    struct _frame_chunk *fs_chunk;
+    struct _frame_slot *fs_prev;    /* slot below in the chunk, or NULL */
+    int fs_free;                    /* the frame has been deallocated */
+} frame_slot;
+
+typedef struct _frame_chunk {
+    struct _frame_chunk *fc_previous;  /* chunk below, or NULL */
+    struct _frame_chunk *fc_spare;     /* empty chunks kept for reuse */
+    frame_slot *fc_last;               /* topmost slot in use, or NULL */
+    char *fc_top;                      /* first free byte */
+    int fc_orphaned;                   /* the thread state was cleared */
+} frame_chunk;
+
+#define FRAME_SLOT_SIZE _Py_SIZE_ROUND_UP(sizeof(frame_slot), FRAME_ALIGNMENT)
+#define FRAME_CHUNK_START(chunk) \
+    ((char *)(chunk) + _Py_SIZE_ROUND_UP(sizeof(frame_chunk), FRAME_ALIGNMENT))
+#define FRAME_CHUNK_END(chunk) ((char *)(chunk) + FRAME_CHUNK_SIZE)
+
+static void
+frame_chunk_free_spares(frame_chunk *chunk)
+{
+    frame_chunk *spare = chunk->fc_spare;
+    chunk->fc_spare = NULL;
+    while (spare != NULL) {
+        frame_chunk *next = spare->fc_spare;
+        PyMem_RawFree(spare);
+        spare = next;
+    }
+}
+
+static frame_chunk *
+frame_chunk_push(PyThreadState *tstate)
+{
+    frame_chunk *previous = tstate->frame_chunk;
+    frame_chunk *chunk;
+    if (previous != NULL && previous->fc_spare != NULL) {
+        chunk = previous->fc_spare;
+        previous->fc_spare = NULL;
+    }
+    else {
+        chunk = (frame_chunk *)PyMem_RawMalloc(FRAME_CHUNK_SIZE);
+        if (chunk == NULL) {
+            return NULL;
+        }
+        chunk->fc_spare = NULL;
+    }
+    chunk->fc_previous = previous;
+    chunk->fc_last = NULL;
+    chunk->fc_top = FRAME_CHUNK_START(chunk);
+    chunk->fc_orphaned = 0;
+    tstate->frame_chunk = chunk;
+    return chunk;
+}
+
+/* Allocate a frame with room for extras locals and stack items from the
+   frame stack of tstate.  Return NULL, without setting an exception, if it
+   doesn't fit in a chunk or no memory is left for a new chunk. */
+static _Py_NO_INLINE PyFrameObject *
+frame_alloc_on_stack(PyThreadState *tstate, Py_ssize_t extras)
+{
+    size_t size = _Py_SIZE_ROUND_UP(
+        FRAME_SLOT_SIZE + sizeof(PyGC_Head)
+        + _PyObject_VAR_SIZE(&PyFrame_Type, extras), FRAME_ALIGNMENT);
+    if (size > FRAME_CHUNK_SIZE / 4) {
+        return NULL;
+    }
+
+    frame_chunk *chunk = tstate->frame_chunk;
+    /* Once the calls using the top chunks have returned, go back to the
+       chunk below them, keeping them as its spares. */
+    while (chunk != NULL && chunk->fc_last == NULL &&
+           chunk->fc_previous != NULL)
+    {
+        frame_chunk *previous = chunk->fc_previous;
+        if (previous->fc_top + size > FRAME_CHUNK_END(previous)) {
+            break;
+        }
+        assert(previous->fc_spare == NULL);
+        previous->fc_spare = chunk;
+        chunk = previous;
+        tstate->frame_chunk = chunk;
+    }
+    if (chunk == NULL || chunk->fc_top + size > FRAME_CHUNK_END(chunk)) {
+        chunk = frame_chunk_push(tstate);
+        if (chunk == NULL) {
+            return NULL;
+        }
+    }
+
+    frame_slot *slot = (frame_slot *)chunk->fc_top;
+    slot->fs_chunk = chunk;
+    slot->fs_prev = chunk->fc_last;
+    slot->fs_free = 0;
+    chunk->fc_last = slot;
+    chunk->fc_top += size;
+
+    PyGC_Head *g = (PyGC_Head *)((char *)slot + FRAME_SLOT_SIZE);
+    g->_gc_next = 0;
+    g->_gc_prev = 0;
+    PyFrameObject *f = (PyFrameObject *)(g + 1);
+    _PyObject_InitVar((PyVarObject *)f, &PyFrame_Type, extras);
+    return f;
+}
+
+static _Py_NO_INLINE void
+frame_free_on_stack(PyFrameObject *f)
+{
+    frame_slot *slot = (frame_slot *)((char *)_Py_AS_GC(f) - FRAME_SLOT_SIZE);
+    frame_chunk *chunk = slot->fs_chunk;
+    slot->fs_free = 1;
+    if (slot != chunk->fc_last) {
+        /* A frame above it is still alive */
+        return;
+    }
+    while (slot != NULL && slot->fs_free) {
+        chunk->fc_top = (char *)slot;
+        slot = slot->fs_prev;
+    }
+    chunk->fc_last = slot;
+    if (slot == NULL && chunk->fc_orphaned) {
+        PyMem_RawFree(chunk);
+    }
+}
+
+/* Release the frame stack of a thread state.  Chunks still holding frames
+   are freed when their last frame is deallocated. */
+void
+_PyFrame_ClearChunks(PyThreadState *tstate)
+{
+    frame_chunk *chunk = tstate->frame_chunk;
+    tstate->frame_chunk = NULL;
+    while (chunk != NULL) {
+        frame_chunk *previous = chunk->fc_previous;
+        frame_chunk_free_spares(chunk);
+        if (chunk->fc_last == NULL) {
+            PyMem_RawFree(chunk);
+        }
+        else {
+            chunk->fc_orphaned = 1;
+        }
+        chunk = previous;
+    }
+}
+
 static void _Py_HOT_FUNCTION
 frame_dealloc(PyFrameObject *f)
 {
@@ -595,7 +859,11 @@ frame_dealloc(PyFrameObject *f)
     Py_CLEAR(f->f_trace);
 
     PyCodeObject *co = f->f_code;
-    if (co->co_zombieframe == NULL) {
+    if (f->f_on_stack) {
+        frame_free_on_stack(f);
+    }
+    else if (co->co_zombieframe == NULL ||
+             co->co_zombieframe == _PyCode_ZOMBIE_IN_USE) {
         co->co_zombieframe = f;
     }
     else {
@@ -769,11 +1037,12 @@ PyTypeObject PyFrame_Type = {
 _Py_IDENTIFIER(__builtins__);
 
 static inline PyFrameObject*
-frame_alloc(PyCodeObject *code)
+frame_alloc(PyThreadState *tstate, PyCodeObject *code)
 {
     PyFrameObject *f = code->co_zombieframe;
-    if (f != NULL) {
-        code->co_zombieframe = NULL;
+    /* Frames allocated on the heap become the zombie when deallocated */
+    code->co_zombieframe = _PyCode_ZOMBIE_IN_USE;
+    if (f != NULL && f != _PyCode_ZOMBIE_IN_USE) {
         _Py_NewReference((PyObject *)f);
         assert(f->f_code == code);
         return f;
@@ -785,9 +1054,20 @@ frame_alloc(PyCodeObject *code)
     struct _Py_frame_state *state = get_frame_state();
     if (state->free_list == NULL)
     {
-        f = PyObject_GC_NewVar(PyFrameObject, &PyFrame_Type, extras);
-        if (f == NULL) {
-            return NULL;
+        if (f == _PyCode_ZOMBIE_IN_USE &&
+            tstate->recursion_depth > PyFrame_MAXFREELIST &&
+            !(code->co_flags & (CO_GENERATOR | CO_COROUTINE |
+                                CO_ASYNC_GENERATOR)) &&
+            (f = frame_alloc_on_stack(tstate, extras)) != NULL)
+        {
+            f->f_on_stack = 1;
+        }
+        else {
+            f = PyObject_GC_NewVar(PyFrameObject, &PyFrame_Type, extras);
+            if (f == NULL) {
+                return NULL;
+            }
+            f->f_on_stack = 0;
         }
     }
     else {
@@ -808,6 +1088,7 @@ frame_alloc(PyCodeObject *code)
             f = new_f;
         }
         _Py_NewReference((PyObject *)f);
+        f->f_on_stack = 0;
     }
 
     extras = code->co_nlocals + ncells + nfrees;
@@ -828,7 +1109,7 @@ _PyFrame_New_NoTrack(PyThreadState *tstate, PyFrameConstructor *con, PyObject *l
     assert(con->fc_code != NULL);
     assert(locals == NULL || PyMapping_Check(locals));
 
-    PyFrameObject *f = frame_alloc((PyCodeObject *)con->fc_code);
+    PyFrameObject *f = frame_alloc(tstate, (PyCodeObject *)con->fc_code);
     if (f == NULL) {
         return NULL;
     }
@@ -1121,6 +1402,12 @@ void
 _PyFrame_ClearFreeList(PyInterpreterState *interp)
 {
     struct _Py_frame_state *state = &interp->frame;
+    PyThreadState *tstate = _PyThreadState_GET();
+    if (tstate != NULL && tstate->interp == interp &&
+        tstate->frame_chunk != NULL)
+    {
+        frame_chunk_free_spares(tstate->frame_chunk);
+    }
     while (state->free_list != NULL) {
         PyFrameObject *f = state->free_list;
         state->free_list = state->free_list->f_back;
@@ -3,6 +3,7 @@
 
 #include "Python.h"
 #include "pycore_ceval.h"         // _Py_EnterRecursiveCall()
+#include "pycore_code.h"          // _PyLazyCode_Type
 #include "pycore_context.h"
 #include "pycore_initconfig.h"
 #include "pycore_object.h"
@@ -1808,6 +1809,7 @@ _PyTypes_Init(void)
     INIT_TYPE(PyClassMethodDescr_Type);
     INIT_TYPE(PyClassMethod_Type);
     INIT_TYPE(PyCode_Type);
+    INIT_TYPE(_PyLazyCode_Type);
     INIT_TYPE(PyComplex_Type);
     INIT_TYPE(PyCoro_Type);
     INIT_TYPE(PyDictItems_Type);
@@ -152,6 +152,13 @@ _PyObject_ArenaMmap(void *ctx, size_t size)
     if (ptr == MAP_FAILED)
         return NULL;
     assert(ptr != NULL);
+#ifdef MADV_HUGEPAGE
+    /* Arenas of 2 MiB or more (see PYMALLOC_ARENA_BITS) are big enough to
+       be backed by transparent huge pages. */
+    if (size >= (2 << 20)) {
+        (void)madvise(ptr, size, MADV_HUGEPAGE);
+    }
+#endif
     return ptr;
 }
 
@@ -901,6 +908,14 @@ static int running_on_valgrind = -1;
 #define WITH_PYMALLOC_RADIX_TREE 1
 #endif
 
+#if !defined(WITH_PYMALLOC_RELEASE_POOLS)
+/* Let the OS reclaim the memory of the empty pools of partially used
+ * arenas with madvise(), see release_pool_memory().  Disabled by default
+ * since a released pool has to be faulted in again when it is reused.
+ * Enable using -DWITH_PYMALLOC_RELEASE_POOLS=1 */
+#define WITH_PYMALLOC_RELEASE_POOLS 0
+#endif
+
 #if SIZEOF_VOID_P > 4
 /* on 64-bit platforms use larger pools and arenas if we can */
 #define USE_LARGE_ARENAS
@@ -922,8 +937,14 @@ static int running_on_valgrind = -1;
  *
  * Arenas are allocated with mmap() on systems supporting anonymous memory
  * mappings to reduce heap fragmentation.
+ *
+ * The arena size can be changed using -DPYMALLOC_ARENA_BITS=n.  Arenas of
+ * 2 MiB (21) or 4 MiB (22) can be backed by transparent huge pages, which
+ * reduces TLB misses but defeats WITH_PYMALLOC_RELEASE_POOLS.
  */
-#ifdef USE_LARGE_ARENAS
+#if defined(PYMALLOC_ARENA_BITS)
+#define ARENA_BITS              PYMALLOC_ARENA_BITS
+#elif defined(USE_LARGE_ARENAS)
 #define ARENA_BITS              20                    /* 1 MiB */
 #else
 #define ARENA_BITS              18                    /* 256 KiB */
@@ -952,11 +973,31 @@ static int running_on_valgrind = -1;
 #endif
 #endif
 
+#if ARENA_BITS < POOL_BITS || ARENA_BITS > 24
+#   error "PYMALLOC_ARENA_BITS must be between the pool bits and 24"
+#endif
+
 #define MAX_POOLS_IN_ARENA  (ARENA_SIZE / POOL_SIZE)
 #if MAX_POOLS_IN_ARENA * POOL_SIZE != ARENA_SIZE
 #   error "arena size not an exact multiple of pool size"
 #endif
 
+#if WITH_PYMALLOC_RELEASE_POOLS
+#  if !defined(ARENAS_USE_MMAP) || !defined(HAVE_MADVISE)
+#    undef WITH_PYMALLOC_RELEASE_POOLS
+#    define WITH_PYMALLOC_RELEASE_POOLS 0
+#  elif defined(MADV_FREE)
+#    define PYMALLOC_MADV_RELEASE MADV_FREE
+#  else
+#    define PYMALLOC_MADV_RELEASE MADV_DONTNEED
+#  endif
+#endif
+#if WITH_PYMALLOC_RELEASE_POOLS && POOL_SIZE <= SYSTEM_PAGE_SIZE
+    /* Nothing to release: the page holding the pool header must be kept */
+#   undef WITH_PYMALLOC_RELEASE_POOLS
+#   define WITH_PYMALLOC_RELEASE_POOLS 0
+#endif
+
 /*
  * -- End of tunable settings section --
  */
@@ -1226,6 +1267,25 @@ static struct arena_object* usable_arenas = NULL;
 /* nfp2lasta[nfp] is the last arena in usable_arenas with nfp free pools */
 static struct arena_object* nfp2lasta[MAX_POOLS_IN_ARENA + 1] = { NULL };
 
+/* Cache of recently emptied pools.
+
+   When a pool becomes empty, pymalloc_free() doesn't give it back to its
+   arena right away: it parks it in this small LIFO cache, where it still
+   counts as allocated in its arena.  allocate_from_new_pool() takes pools
+   from the cache first, preferring one that last held blocks of the
+   requested size class, whose header and free list are then already
+   initialized.  When the cache is full, its older half is handed back to
+   the arenas in one batch.
+
+   This saves the usable_arenas bookkeeping -- and at worst freeing and
+   reallocating a whole arena -- when the number of used pools of a size
+   class keeps going back and forth between zero and one.  Like the rest of
+   pymalloc, the cache is protected by the GIL.
+*/
+#define POOL_CACHE_SIZE 8
+static poolp pool_cache[POOL_CACHE_SIZE];
+static uint pool_cache_count = 0;
+
 /* How many arena_objects do we initially allocate?
  * 16 = can allocate 16 arenas = 16 * ARENA_SIZE = 4MB before growing the
  * `arenas` vector.
@@ -1240,6 +1300,13 @@ static size_t ntimes_arena_allocated = 0;
 /* High water mark (max value ever seen) for narenas_currently_allocated. */
 static size_t narenas_highwater = 0;
 
+#if WITH_PYMALLOC_RELEASE_POOLS
+/* Number of times the memory of an empty pool was given back to the OS,
+   and the total number of bytes given back that way. */
+static size_t ntimes_pool_released = 0;
+static size_t npool_bytes_released = 0;
+#endif
+
 static Py_ssize_t raw_allocated_blocks;
 
 Py_ssize_t
@@ -1758,6 +1825,30 @@ pymalloc_pool_extend(poolp pool, uint size)
     pool->nextpool = next;
 }
 
+/* Take a pool out of the pool cache, preferably one which last contained
+ * blocks of size class 'size'.  Return NULL if the cache is empty.
+ */
+static poolp
+take_cached_pool(uint size)
+{
+    if (pool_cache_count == 0) {
+        return NULL;
+    }
+    uint i = pool_cache_count - 1;
+    for (uint j = pool_cache_count; j-- > 0; ) {
+        if (pool_cache[j]->szidx == size) {
+            i = j;
+            break;
+        }
+    }
+    poolp pool = pool_cache[i];
+    assert(pool->ref.count == 0);
+    pool_cache_count--;
+    memmove(&pool_cache[i], &pool_cache[i + 1],
+            (pool_cache_count - i) * sizeof(poolp));
+    return pool;
+}
+
 /* called when pymalloc_alloc can not allocate a block from usedpool.
  * This function takes new pool and allocate a block from it.
  */
@@ -1765,8 +1856,13 @@ static void*
 allocate_from_new_pool(uint size)
 {
     /* There isn't a pool of the right size class immediately
-     * available:  use a free pool.
+     * available:  use a recently emptied pool, or a free pool.
      */
+    poolp pool = take_cached_pool(size);
+    if (pool != NULL) {
+        goto init_pool;
+    }
+
     if (UNLIKELY(usable_arenas == NULL)) {
         /* No arena has a free pool:  allocate a new arena. */
 #ifdef WITH_MEMORY_LIMITS
@@ -1801,7 +1897,7 @@ allocate_from_new_pool(uint size)
     }
 
     /* Try to get a cached free pool. */
-    poolp pool = usable_arenas->freepools;
+    pool = usable_arenas->freepools;
     if (LIKELY(pool != NULL)) {
         /* Unlink from cached pools. */
         usable_arenas->freepools = pool->nextpool;
@@ -1856,6 +1952,7 @@ allocate_from_new_pool(uint size)
         }
     }
 
+init_pool:
     /* Frontlink to used pools. */
     block *bp;
     poolp next = usedpools[size + size]; /* == prev */
@@ -1997,14 +2094,34 @@ insert_to_usedpool(poolp pool)
     prev->nextpool = pool;
 }
 
+#if WITH_PYMALLOC_RELEASE_POOLS
+/* Let the OS reclaim the pages of an empty pool that stays in a partially
+ * used arena.  The first page is kept since it holds the pool header, which
+ * is still needed for the freepools list and address_in_range().
+ */
 static void
-insert_to_freepool(poolp pool)
+release_pool_memory(poolp pool)
 {
-    poolp next = pool->nextpool;
-    poolp prev = pool->prevpool;
-    next->prevpool = prev;
-    prev->nextpool = next;
+    const size_t nbytes = POOL_SIZE - SYSTEM_PAGE_SIZE;
+    if (madvise((char *)pool + SYSTEM_PAGE_SIZE, nbytes,
+                PYMALLOC_MADV_RELEASE) != 0) {
+        return;
+    }
+    /* The released pages may read back as zeros, which would break the
+     * pool's free list: force the pool to be reinitialized on reuse.
+     */
+    pool->szidx = DUMMY_SIZE_IDX;
+    ntimes_pool_released++;
+    npool_bytes_released += nbytes;
+}
+#endif
 
+/* Give an empty pool, which must not be in a usedpools[] list, back to its
+ * arena.
+ */
+static void
+insert_to_freepool(poolp pool)
+{
     /* Link the pool to freepools.  This is a singly-linked
      * list, and pool->prevpool isn't used there.
      */
@@ -2093,6 +2210,10 @@ insert_to_freepool(poolp pool)
         return;
     }
 
+#if WITH_PYMALLOC_RELEASE_POOLS
+    release_pool_memory(pool);
+#endif
+
     if (nf == 1) {
         /* Case 2.  Put ao at the head of
          * usable_arenas.  Note that because
@@ -2164,6 +2285,26 @@ insert_to_freepool(poolp pool)
            || ao->prevarena->nextarena == ao);
 }
 
+/* Park an empty pool, already unlinked from its usedpools[] list, in the
+ * pool cache.  If the cache is full, first give its older half back to the
+ * arenas.
+ */
+static void
+insert_to_pool_cache(poolp pool)
+{
+    assert(pool->ref.count == 0);
+    if (UNLIKELY(pool_cache_count == POOL_CACHE_SIZE)) {
+        const uint n = POOL_CACHE_SIZE / 2;
+        for (uint i = 0; i < n; i++) {
+            insert_to_freepool(pool_cache[i]);
+        }
+        pool_cache_count -= n;
+        memmove(&pool_cache[0], &pool_cache[n],
+                pool_cache_count * sizeof(poolp));
+    }
+    pool_cache[pool_cache_count++] = pool;
+}
+
 /* Free a memory block allocated by pymalloc_alloc().
    Return 1 if it was freed.
    Return 0 if the block was not allocated by pymalloc_alloc(). */
@@ -2216,11 +2357,16 @@ pymalloc_free(void *ctx, void *p)
     }
 
     /* Pool is now empty:  unlink from usedpools, and
-     * link to the front of freepools.  This ensures that
-     * previously freed pools will be allocated later
+     * park it in the pool cache.  Pools evicted from the cache
+     * are linked to the front of their arena's freepools.  This
+     * ensures that previously freed pools will be allocated later
      * (being not referenced, they are perhaps paged out).
      */
-    insert_to_freepool(pool);
+    poolp next = pool->nextpool;
+    poolp prev = pool->prevpool;
+    next->prevpool = prev;
+    prev->nextpool = next;
+    insert_to_pool_cache(pool);
     return 1;
 }
 
@@ -2898,6 +3044,18 @@ pool_is_in_list(const poolp target, poolp list)
     } while (list != NULL && list != origlist);
     return 0;
 }
+
+/* Is target in the pool cache? */
+static int
+pool_is_in_cache(const poolp target)
+{
+    for (uint i = 0; i < pool_cache_count; i++) {
+        if (pool_cache[i] == target) {
+            return 1;
+        }
+    }
+    return 0;
+}
 #endif
 
 /* Print summary info to "out" about the state of pymalloc's structures.
@@ -2980,7 +3138,8 @@ _PyObject_DebugMallocStats(FILE *out)
             if (p->ref.count == 0) {
                 /* currently unused */
 #ifdef Py_DEBUG
-                assert(pool_is_in_list(p, arenas[i].freepools));
+                assert(pool_is_in_list(p, arenas[i].freepools) ||
+                       pool_is_in_cache(p));
 #endif
                 continue;
             }
@@ -2995,6 +3154,8 @@ _PyObject_DebugMallocStats(FILE *out)
         }
     }
     assert(narenas == narenas_currently_allocated);
+    /* Pools in the pool cache are unused too. */
+    numfreepools += pool_cache_count;
 
     fputc('\n', out);
     fputs("class   size   num pools   blocks in use  avail blocks\n"
@@ -3027,6 +3188,11 @@ _PyObject_DebugMallocStats(FILE *out)
     (void)printone(out, "# arenas reclaimed", ntimes_arena_allocated - narenas);
     (void)printone(out, "# arenas highwater mark", narenas_highwater);
     (void)printone(out, "# arenas allocated current", narenas);
+    (void)printone(out, "# pools in the empty pool cache", pool_cache_count);
+#if WITH_PYMALLOC_RELEASE_POOLS
+    (void)printone(out, "# pools released to the OS", ntimes_pool_released);
+    (void)printone(out, "# bytes released to the OS", npool_bytes_released);
+#endif
 
     PyOS_snprintf(buf, sizeof(buf),
                   "%zu arenas * %d bytes/arena",
@@ -537,21 +537,74 @@ token_name(int type)
 }
 #endif
 
+#define MEMO_INITIAL_SIZE 4
+
+// Return the entry of the memo table of a token for type: either the one
+// holding it, the unused one where it would be inserted or NULL if the table
+// is full.  The tables are small, so they are allowed to fill up completely.
+static inline Memo *
+memo_lookup(Memo *memo, int size, int type)
+{
+    int mask = size - 1;
+    int i = type & mask;
+    for (int n = 0; n < size; n++) {
+        if (memo[i].type == type || memo[i].type == 0) {
+            return &memo[i];
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+// Double the size of the memo table of a token (or allocate it).
+static int
+memo_resize(Token *t)
+{
+    int size = t->memo_size ? t->memo_size * 2 : MEMO_INITIAL_SIZE;
+    Memo *memo = PyMem_Calloc(size, sizeof(Memo));
+    if (memo == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (int i = 0; i < t->memo_size; i++) {
+        *memo_lookup(memo, size, t->memo[i].type) = t->memo[i];
+    }
+    PyMem_Free(t->memo);
+    t->memo = memo;
+    t->memo_size = size;
+    return 0;
+}
+
+static void
+memo_clear(Token *t)
+{
+    PyMem_Free(t->memo);
+    t->memo = NULL;
+    t->memo_size = t->memo_used = 0;
+}
+
 // Here, mark is the start of the node, while p->mark is the end.
 // If node==NULL, they should be the same.
 int
 _PyPegen_insert_memo(Parser *p, int mark, int type, void *node)
 {
-    // Insert in front
-    Memo *m = _PyArena_Malloc(p->arena, sizeof(Memo));
-    if (m == NULL) {
-        return -1;
+    assert(type != 0);
+    Token *t = p->tokens[mark];
+    Memo *m = NULL;
+    if (t->memo_used == 0
+        || (m = memo_lookup(t->memo, t->memo_size, type)) == NULL)
+    {
+        if (memo_resize(t) < 0) {
+            return -1;
+        }
+        m = memo_lookup(t->memo, t->memo_size, type);
+    }
+    if (m->type == 0) {
+        m->type = type;
+        t->memo_used++;
     }
-    m->type = type;
     m->node = node;
     m->mark = p->mark;
-    m->next = p->tokens[mark]->memo;
-    p->tokens[mark]->memo = m;
     return 0;
 }
 
@@ -559,15 +612,6 @@ _PyPegen_insert_memo(Parser *p, int mark, int type, void *node)
 int
 _PyPegen_update_memo(Parser *p, int mark, int type, void *node)
 {
-    for (Memo *m = p->tokens[mark]->memo; m != NULL; m = m->next) {
-        if (m->type == type) {
-            // Update existing node.
-            m->node = node;
-            m->mark = p->mark;
-            return 0;
-        }
-    }
-    // Insert new node.
     return _PyPegen_insert_memo(p, mark, type, node);
 }
 
@@ -668,6 +712,8 @@ initialize_token(Parser *p, Token *token, const char *start, const char *end, in
     token->col_offset = p->tok->lineno == 1 ? p->starting_col_offset + col_offset : col_offset;
     token->end_lineno = p->starting_lineno + end_lineno;
     token->end_col_offset = p->tok->lineno == 1 ? p->starting_col_offset + end_col_offset : end_col_offset;
+    token->memo = NULL;
+    token->memo_size = token->memo_used = 0;
 
     p->fill += 1;
 
@@ -678,8 +724,15 @@ initialize_token(Parser *p, Token *token, const char *start, const char *end, in
     return (token_type == ERRORTOKEN ? tokenizer_error(p) : 0);
 }
 
+// The tokens are allocated from the arena in contiguous blocks, one for each
+// doubling of the array of pointers to them.  A token never moves, so the
+// rules can keep pointers to them.
 static int
 _resize_tokens_array(Parser *p) {
+    if (p->size > INT_MAX / 2) {
+        PyErr_NoMemory();
+        return -1;
+    }
     int newsize = p->size * 2;
     Token **new_tokens = PyMem_Realloc(p->tokens, newsize * sizeof(Token *));
     if (new_tokens == NULL) {
@@ -688,13 +741,13 @@ _resize_tokens_array(Parser *p) {
     }
     p->tokens = new_tokens;
 
+    Token *block = _PyArena_Malloc(p->arena,
+                                   (size_t)(newsize - p->size) * sizeof(Token));
+    if (block == NULL) {
+        return -1;
+    }
     for (int i = p->size; i < newsize; i++) {
-        p->tokens[i] = PyMem_Calloc(1, sizeof(Token));
-        if (p->tokens[i] == NULL) {
-            p->size = i; // Needed, in order to cleanup correctly after parser fails
-            PyErr_NoMemory();
-            return -1;
-        }
+        p->tokens[i] = &block[i - p->size];
     }
     p->size = newsize;
     return 0;
@@ -799,25 +852,26 @@ _PyPegen_is_memoized(Parser *p, int type, void *pres)
     }
 
     Token *t = p->tokens[p->mark];
-
-    for (Memo *m = t->memo; m != NULL; m = m->next) {
-        if (m->type == type) {
+    if (t->memo_used == 0) {
+        return 0;
+    }
+    Memo *m = memo_lookup(t->memo, t->memo_size, type);
+    if (m == NULL || m->type == 0) {
+        return 0;
+    }
 #if defined(PY_DEBUG)
-            if (0 <= type && type < NSTATISTICS) {
-                long count = m->mark - p->mark;
-                // A memoized negative result counts for one.
-                if (count <= 0) {
-                    count = 1;
-                }
-                memo_statistics[type] += count;
-            }
-#endif
-            p->mark = m->mark;
-            *(void **)(pres) = m->node;
-            return 1;
+    if (0 <= type && type < NSTATISTICS) {
+        long count = m->mark - p->mark;
+        // A memoized negative result counts for one.
+        if (count <= 0) {
+            count = 1;
         }
+        memo_statistics[type] += count;
     }
-    return 0;
+#endif
+    p->mark = m->mark;
+    *(void **)(pres) = m->node;
+    return 1;
 }
 
 int
@@ -1138,8 +1192,8 @@ void
 _PyPegen_Parser_Free(Parser *p)
 {
     Py_XDECREF(p->normalize);
-    for (int i = 0; i < p->size; i++) {
-        PyMem_Free(p->tokens[i]);
+    for (int i = 0; i < p->fill; i++) {
+        memo_clear(p->tokens[i]);
     }
     PyMem_Free(p->tokens);
     growable_comment_array_deallocate(&p->type_ignore_comments);
@@ -1191,14 +1245,13 @@ _PyPegen_Parser_New(struct tok_state *tok, int start_rule, int flags,
         PyMem_Free(p);
         return (Parser *) PyErr_NoMemory();
     }
-    p->tokens[0] = PyMem_Calloc(1, sizeof(Token));
-    if (!p->tokens) {
+    p->tokens[0] = _PyArena_Malloc(arena, sizeof(Token));
+    if (!p->tokens[0]) {
         PyMem_Free(p->tokens);
         PyMem_Free(p);
-        return (Parser *) PyErr_NoMemory();
+        return NULL;
     }
     if (!growable_comment_array_init(&p->type_ignore_comments, 10)) {
-        PyMem_Free(p->tokens[0]);
         PyMem_Free(p->tokens);
         PyMem_Free(p);
         return (Parser *) PyErr_NoMemory();
@@ -1230,7 +1283,7 @@ static void
 reset_parser_state(Parser *p)
 {
     for (int i = 0; i < p->fill; i++) {
-        p->tokens[i]->memo = NULL;
+        memo_clear(p->tokens[i]);
     }
     p->mark = 0;
     p->call_invalid_rules = 1;
@@ -23,18 +23,20 @@
 #define PyPARSE_TYPE_COMMENTS 0x0040
 #define PyPARSE_ASYNC_HACKS   0x0080
 
-typedef struct _memo {
+// An entry of the memo table of a token, keyed by the rule type.  Rule types
+// are never 0, which marks unused entries.
+typedef struct {
     int type;
+    int mark;  // Where the parse of the rule ended
     void *node;
-    int mark;
-    struct _memo *next;
 } Memo;
 
 typedef struct {
     int type;
     PyObject *bytes;
     int lineno, col_offset, end_lineno, end_col_offset;
-    Memo *memo;
+    Memo *memo;  // Open-addressed table of memo_size entries, or NULL
+    int memo_size, memo_used;
 } Token;
 
 typedef struct {
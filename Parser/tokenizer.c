@@ -6,6 +6,10 @@
 
 #include <ctype.h>
 #include <assert.h>
+#if defined(__SSE2__) && defined(__GNUC__)
+#  include <emmintrin.h>
+#  define TOK_USE_SSE2
+#endif
 
 #include "tokenizer.h"
 #include "errcode.h"
@@ -1047,6 +1051,91 @@ tok_nextc(struct tok_state *tok)
     Py_UNREACHABLE();
 }
 
+/* Bulk scanning of the characters already in the buffer.
+
+   The loops of tok_get() which consume runs of identifier characters,
+   indentation, comments and string bodies call these on the bytes between
+   tok->cur and tok->inp first, so that only the character ending the run
+   (or the end of the buffer) goes through tok_nextc(). */
+
+/* Return the first byte in [p, end) which is not an identifier character.
+   Set *nonascii if a non-ASCII byte was skipped. */
+static const char *
+scan_identifier(const char *p, const char *end, int *nonascii)
+{
+#ifdef TOK_USE_SSE2
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        /* ORing 0x20 maps 'A'-'Z' to 'a'-'z' and nothing else into it */
+        __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                      _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                      _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+        __m128i under = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+        /* Bytes >= 128 are negative */
+        int high = _mm_movemask_epi8(v);
+        int ok = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit),
+                                                under)) | high;
+        if (ok != 0xFFFF) {
+            int n = __builtin_ctz(~ok);
+            if (high & ((1 << n) - 1)) {
+                *nonascii = 1;
+            }
+            return p + n;
+        }
+        if (high) {
+            *nonascii = 1;
+        }
+        p += 16;
+    }
+#endif
+    while (p < end && is_potential_identifier_char(Py_CHARMASK(*p))) {
+        if (Py_CHARMASK(*p) >= 128) {
+            *nonascii = 1;
+        }
+        p++;
+    }
+    return p;
+}
+
+/* Return the first byte in [p, end) which is not a space. */
+static const char *
+scan_spaces(const char *p, const char *end)
+{
+    while (p < end && *p == ' ') {
+        p++;
+    }
+    return p;
+}
+
+/* Return the first byte in [p, end) which is the quote, a backslash or a
+   newline, i.e. which may end the body of a string literal. */
+static const char *
+scan_string_body(const char *p, const char *end, char quote)
+{
+#ifdef TOK_USE_SSE2
+    const __m128i q = _mm_set1_epi8(quote);
+    const __m128i bs = _mm_set1_epi8('\\');
+    const __m128i nl = _mm_set1_epi8('\n');
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)p);
+        __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, q),
+                                                    _mm_cmpeq_epi8(v, bs)),
+                                       _mm_cmpeq_epi8(v, nl));
+        int mask = _mm_movemask_epi8(special);
+        if (mask) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+#endif
+    while (p < end && *p != quote && *p != '\\' && *p != '\n') {
+        p++;
+    }
+    return p;
+}
+
 /* Back-up one character */
 
 static void
@@ -1213,6 +1302,10 @@ tok_get(struct tok_state *tok, const char **p_start, const char **p_end)
         int altcol = 0;
         tok->atbol = 0;
         for (;;) {
+            const char *p = scan_spaces(tok->cur, tok->inp);
+            col += (int)(p - tok->cur);
+            altcol += (int)(p - tok->cur);
+            tok->cur = (char *)p;
             c = tok_nextc(tok);
             if (c == ' ') {
                 col++, altcol++;
@@ -1345,6 +1438,10 @@ tok_get(struct tok_state *tok, const char **p_start, const char **p_end)
         const char *prefix, *p, *type_start;
 
         while (c != EOF && c != '\n') {
+            if (tok->cur < tok->inp) {
+                p = memchr(tok->cur, '\n', tok->inp - tok->cur);
+                tok->cur = p ? (char *)p : tok->inp;
+            }
             c = tok_nextc(tok);
         }
 
@@ -1440,6 +1537,7 @@ tok_get(struct tok_state *tok, const char **p_start, const char **p_end)
             if (c >= 128) {
                 nonascii = 1;
             }
+            tok->cur = (char *)scan_identifier(tok->cur, tok->inp, &nonascii);
             c = tok_nextc(tok);
         }
         tok_backup(tok, c);
@@ -1744,6 +1842,11 @@ tok_get(struct tok_state *tok, const char **p_start, const char **p_end)
 
         /* Get rest of string */
         while (end_quote_size != quote_size) {
+            const char *p = scan_string_body(tok->cur, tok->inp, (char)quote);
+            if (p != tok->cur) {
+                tok->cur = (char *)p;
+                end_quote_size = 0;
+            }
             c = tok_nextc(tok);
             if (c == EOF || (quote_size == 1 && c == '\n')) {
                 // shift the tok_state's location into
@@ -25,6 +25,7 @@ static const struct _frozen _PyImport_FrozenModules[] = {
    from frozen.obj. In the Makefile, frozen.o is not linked into this executable,
    so we define the variable here. */
 const struct _frozen *PyImport_FrozenModules;
+const struct _frozen *_PyImport_FrozenStdlibModules;
 #endif
 
 static const char header[] =
@@ -43,6 +44,9 @@ main(int argc, char *argv[])
     PyObject *code = NULL, *marshalled = NULL;
 
     PyImport_FrozenModules = _PyImport_FrozenModules;
+#ifndef MS_WINDOWS
+    _PyImport_FrozenStdlibModules = _PyImport_FrozenModules;
+#endif
 
     if (argc != 4) {
         fprintf(stderr, "need to specify the name, input and output paths\n");
@@ -29,6 +29,7 @@
 #include "opcode.h"
 #include "pydtrace.h"
 #include "setobject.h"
+#include "longintrepr.h"         // digit
 #include "structmember.h"         // struct PyMemberDef, T_OFFSET_EX
 
 #include <ctype.h>
@@ -95,6 +96,7 @@ static PyObject * special_lookup(PyThreadState *, PyObject *, _Py_Identifier *);
 static int check_args_iterable(PyThreadState *, PyObject *func, PyObject *vararg);
 static void format_kwargs_error(PyThreadState *, PyObject *func, PyObject *kwargs);
 static void format_awaitable_error(PyThreadState *, PyTypeObject *, int, int);
+static Py_ssize_t store_attr_cache_hint(PyObject *, PyObject *);
 
 #define NAME_ERROR_MSG \
     "name '%.200s' is not defined"
@@ -117,7 +119,6 @@ static long dxp[256];
 /* per opcode cache */
 static int opcache_min_runs = 1024;  /* create opcache when code executed this many times */
 #define OPCODE_CACHE_MAX_TRIES 20
-#define OPCACHE_STATS 0  /* Enable stats */
 
 // This function allows to deactivate the opcode cache. As different cache mechanisms may hold
 // references, this can mess with the reference leak detector functionality so the cache needs
@@ -128,20 +129,81 @@ _PyEval_DeactivateOpCache(void)
     opcache_min_runs = 0;
 }
 
-#if OPCACHE_STATS
-static size_t opcache_code_objects = 0;
-static size_t opcache_code_objects_extra_mem = 0;
+/* Opcode cache statistics, switched on at runtime with sys._set_opcache_stats() */
+static int opcache_stats_enabled = 0;
+static _PyOpcacheStats opcache_stats;  /* totals for all code objects */
 
-static size_t opcache_global_opts = 0;
-static size_t opcache_global_hits = 0;
-static size_t opcache_global_misses = 0;
+void
+_PyEval_SetOpcacheStats(int enable)
+{
+    opcache_stats_enabled = enable;
+}
 
-static size_t opcache_attr_opts = 0;
-static size_t opcache_attr_hits = 0;
-static size_t opcache_attr_misses = 0;
-static size_t opcache_attr_deopts = 0;
-static size_t opcache_attr_total = 0;
-#endif
+static void
+opcache_stat_record(PyCodeObject *co, int kind, int event)
+{
+    opcache_stats.counts[kind][event]++;
+    if (co->co_opcache_stats == NULL) {
+        co->co_opcache_stats = PyMem_Calloc(1, sizeof(_PyOpcacheStats));
+        if (co->co_opcache_stats == NULL) {
+            /* Statistics are best effort: only the totals are updated */
+            return;
+        }
+    }
+    co->co_opcache_stats->counts[kind][event]++;
+}
+
+/* Return the opcode cache statistics of a code object, or the totals for all
+   code objects if co is NULL, as a dict of dicts: {opname: {event: count}} */
+PyObject *
+_PyEval_GetOpcacheStats(PyCodeObject *co)
+{
+    static const char * const kind_names[_PyOpcache_STAT_NKINDS] = {
+        "LOAD_GLOBAL", "LOAD_ATTR", "STORE_ATTR", "BINARY_SUBSCR",
+        "CALL_FUNCTION",
+    };
+    static const char * const event_names[_PyOpcache_STAT_NEVENTS] = {
+        "opts", "hits", "misses", "deopts",
+    };
+    static const _PyOpcacheStats no_stats;
+
+    const _PyOpcacheStats *stats = &opcache_stats;
+    if (co != NULL) {
+        stats = co->co_opcache_stats != NULL ? co->co_opcache_stats : &no_stats;
+    }
+
+    PyObject *res = PyDict_New();
+    if (res == NULL) {
+        return NULL;
+    }
+    for (int kind = 0; kind < _PyOpcache_STAT_NKINDS; kind++) {
+        PyObject *counts = PyDict_New();
+        if (counts == NULL) {
+            goto error;
+        }
+        if (PyDict_SetItemString(res, kind_names[kind], counts) < 0) {
+            Py_DECREF(counts);
+            goto error;
+        }
+        Py_DECREF(counts);
+        for (int event = 0; event < _PyOpcache_STAT_NEVENTS; event++) {
+            PyObject *value = PyLong_FromSize_t(stats->counts[kind][event]);
+            if (value == NULL) {
+                goto error;
+            }
+            if (PyDict_SetItemString(counts, event_names[event], value) < 0) {
+                Py_DECREF(value);
+                goto error;
+            }
+            Py_DECREF(value);
+        }
+    }
+    return res;
+
+error:
+    Py_DECREF(res);
+    return NULL;
+}
 
 
 #ifndef NDEBUG
@@ -368,49 +430,6 @@ PyEval_InitThreads(void)
 void
 _PyEval_Fini(void)
 {
-#if OPCACHE_STATS
-    fprintf(stderr, "-- Opcode cache number of objects  = %zd\n",
-            opcache_code_objects);
-
-    fprintf(stderr, "-- Opcode cache total extra mem    = %zd\n",
-            opcache_code_objects_extra_mem);
-
-    fprintf(stderr, "\n");
-
-    fprintf(stderr, "-- Opcode cache LOAD_GLOBAL hits   = %zd (%d%%)\n",
-            opcache_global_hits,
-            (int) (100.0 * opcache_global_hits /
-                (opcache_global_hits + opcache_global_misses)));
-
-    fprintf(stderr, "-- Opcode cache LOAD_GLOBAL misses = %zd (%d%%)\n",
-            opcache_global_misses,
-            (int) (100.0 * opcache_global_misses /
-                (opcache_global_hits + opcache_global_misses)));
-
-    fprintf(stderr, "-- Opcode cache LOAD_GLOBAL opts   = %zd\n",
-            opcache_global_opts);
-
-    fprintf(stderr, "\n");
-
-    fprintf(stderr, "-- Opcode cache LOAD_ATTR hits     = %zd (%d%%)\n",
-            opcache_attr_hits,
-            (int) (100.0 * opcache_attr_hits /
-                opcache_attr_total));
-
-    fprintf(stderr, "-- Opcode cache LOAD_ATTR misses   = %zd (%d%%)\n",
-            opcache_attr_misses,
-            (int) (100.0 * opcache_attr_misses /
-                opcache_attr_total));
-
-    fprintf(stderr, "-- Opcode cache LOAD_ATTR opts     = %zd\n",
-            opcache_attr_opts);
-
-    fprintf(stderr, "-- Opcode cache LOAD_ATTR deopts   = %zd\n",
-            opcache_attr_deopts);
-
-    fprintf(stderr, "-- Opcode cache LOAD_ATTR total    = %zd\n",
-            opcache_attr_total);
-#endif
 }
 
 void
@@ -1385,6 +1404,35 @@ eval_frame_handle_pending(PyThreadState *tstate)
 #endif
 #define PREDICTED(op)           PREDICT_ID(op):
 
+/* Superinstruction macros
+    Hot code objects run a quickened copy of their bytecode (see
+    _PyCode_Quicken()) where the first instruction of some common pairs is
+    replaced by a superinstruction.  A superinstruction carries the argument
+    of the first instruction: it runs the body of the first instruction,
+    then jumps straight to the second one, saving a trip through the
+    dispatch code.  The second instruction is left untouched, so that jumps
+    to it still work.
+
+    When tracing, a superinstruction runs as its first instruction alone,
+    so that each instruction still gets its own trace events.
+*/
+
+#define SUPERINSTRUCTION_FIRST(op) \
+    do { \
+        if (trace_info.cframe.use_tracing OR_DTRACE_LINE OR_LLTRACE) { \
+            opcode = op; \
+            goto dispatch_opcode; \
+        } \
+    } while (0)
+
+#define SUPERINSTRUCTION_NEXT(op) \
+    do { \
+        f->f_lasti = INSTR_OFFSET(); \
+        NEXTOPARG(); \
+        assert(opcode == op); \
+        goto PREDICT_ID(op); \
+    } while (0)
+
 
 /* Stack manipulation macros */
 
@@ -1449,12 +1497,6 @@ eval_frame_handle_pending(PyThreadState *tstate)
                                      Py_XDECREF(tmp); } while (0)
 
 
-#define UNWIND_BLOCK(b) \
-    while (STACK_LEVEL() > (b)->b_level) { \
-        PyObject *v = POP(); \
-        Py_XDECREF(v); \
-    }
-
 #define UNWIND_EXCEPT_HANDLER(b) \
     do { \
         PyObject *type, *value, *traceback; \
@@ -1498,7 +1540,7 @@ eval_frame_handle_pending(PyThreadState *tstate)
             unsigned char co_opcache_offset = \
                 co->co_opcache_map[next_instr - first_instr]; \
             assert(co_opcache_offset <= co->co_opcache_size); \
-            co->co_opcache_map[co_opcache_offset] = 0; \
+            co->co_opcache_map[next_instr - first_instr] = 0; \
             co_opcache = NULL; \
         } \
     } while (0)
@@ -1518,61 +1560,82 @@ eval_frame_handle_pending(PyThreadState *tstate)
         } \
     } while (0)
 
-#if OPCACHE_STATS
-
-#define OPCACHE_STAT_GLOBAL_HIT() \
+#define OPCACHE_DEOPT_STORE_ATTR() \
     do { \
-        if (co->co_opcache != NULL) opcache_global_hits++; \
+        if (co_opcache != NULL) { \
+            OPCACHE_STAT_STORE_ATTR_DEOPT(); \
+            OPCACHE_DEOPT(); \
+        } \
     } while (0)
 
-#define OPCACHE_STAT_GLOBAL_MISS() \
+#define OPCACHE_MAYBE_DEOPT_STORE_ATTR() \
     do { \
-        if (co->co_opcache != NULL) opcache_global_misses++; \
+        if (co_opcache != NULL && --co_opcache->optimized <= 0) { \
+            OPCACHE_DEOPT_STORE_ATTR(); \
+        } \
     } while (0)
 
-#define OPCACHE_STAT_GLOBAL_OPT() \
+#define OPCACHE_DEOPT_SUBSCR() \
     do { \
-        if (co->co_opcache != NULL) opcache_global_opts++; \
+        if (co_opcache != NULL) { \
+            OPCACHE_STAT_SUBSCR_DEOPT(); \
+            OPCACHE_DEOPT(); \
+        } \
     } while (0)
 
-#define OPCACHE_STAT_ATTR_HIT() \
+#define OPCACHE_MAYBE_DEOPT_SUBSCR() \
     do { \
-        if (co->co_opcache != NULL) opcache_attr_hits++; \
+        if (co_opcache != NULL && --co_opcache->optimized <= 0) { \
+            OPCACHE_DEOPT_SUBSCR(); \
+        } \
     } while (0)
 
-#define OPCACHE_STAT_ATTR_MISS() \
+#define OPCACHE_DEOPT_CALL() \
     do { \
-        if (co->co_opcache != NULL) opcache_attr_misses++; \
+        if (co_opcache != NULL) { \
+            OPCACHE_STAT_CALL_DEOPT(); \
+            OPCACHE_DEOPT(); \
+        } \
     } while (0)
 
-#define OPCACHE_STAT_ATTR_OPT() \
+#define OPCACHE_MAYBE_DEOPT_CALL() \
     do { \
-        if (co->co_opcache!= NULL) opcache_attr_opts++; \
+        if (co_opcache != NULL && --co_opcache->optimized <= 0) { \
+            OPCACHE_DEOPT_CALL(); \
+        } \
     } while (0)
 
-#define OPCACHE_STAT_ATTR_DEOPT() \
+#define OPCACHE_STAT(kind, event) \
     do { \
-        if (co->co_opcache != NULL) opcache_attr_deopts++; \
+        if (opcache_stats_enabled && co->co_opcache != NULL) { \
+            opcache_stat_record(co, _PyOpcache_STAT_##kind, \
+                                _PyOpcache_STAT_##event); \
+        } \
     } while (0)
 
-#define OPCACHE_STAT_ATTR_TOTAL() \
-    do { \
-        if (co->co_opcache != NULL) opcache_attr_total++; \
-    } while (0)
+#define OPCACHE_STAT_GLOBAL_HIT() OPCACHE_STAT(LOAD_GLOBAL, HITS)
+#define OPCACHE_STAT_GLOBAL_MISS() OPCACHE_STAT(LOAD_GLOBAL, MISSES)
+#define OPCACHE_STAT_GLOBAL_OPT() OPCACHE_STAT(LOAD_GLOBAL, OPTS)
 
-#else /* OPCACHE_STATS */
+#define OPCACHE_STAT_ATTR_HIT() OPCACHE_STAT(LOAD_ATTR, HITS)
+#define OPCACHE_STAT_ATTR_MISS() OPCACHE_STAT(LOAD_ATTR, MISSES)
+#define OPCACHE_STAT_ATTR_OPT() OPCACHE_STAT(LOAD_ATTR, OPTS)
+#define OPCACHE_STAT_ATTR_DEOPT() OPCACHE_STAT(LOAD_ATTR, DEOPTS)
 
-#define OPCACHE_STAT_GLOBAL_HIT()
-#define OPCACHE_STAT_GLOBAL_MISS()
-#define OPCACHE_STAT_GLOBAL_OPT()
+#define OPCACHE_STAT_STORE_ATTR_HIT() OPCACHE_STAT(STORE_ATTR, HITS)
+#define OPCACHE_STAT_STORE_ATTR_MISS() OPCACHE_STAT(STORE_ATTR, MISSES)
+#define OPCACHE_STAT_STORE_ATTR_OPT() OPCACHE_STAT(STORE_ATTR, OPTS)
+#define OPCACHE_STAT_STORE_ATTR_DEOPT() OPCACHE_STAT(STORE_ATTR, DEOPTS)
 
-#define OPCACHE_STAT_ATTR_HIT()
-#define OPCACHE_STAT_ATTR_MISS()
-#define OPCACHE_STAT_ATTR_OPT()
-#define OPCACHE_STAT_ATTR_DEOPT()
-#define OPCACHE_STAT_ATTR_TOTAL()
+#define OPCACHE_STAT_SUBSCR_HIT() OPCACHE_STAT(BINARY_SUBSCR, HITS)
+#define OPCACHE_STAT_SUBSCR_MISS() OPCACHE_STAT(BINARY_SUBSCR, MISSES)
+#define OPCACHE_STAT_SUBSCR_OPT() OPCACHE_STAT(BINARY_SUBSCR, OPTS)
+#define OPCACHE_STAT_SUBSCR_DEOPT() OPCACHE_STAT(BINARY_SUBSCR, DEOPTS)
 
-#endif
+#define OPCACHE_STAT_CALL_HIT() OPCACHE_STAT(CALL_FUNCTION, HITS)
+#define OPCACHE_STAT_CALL_MISS() OPCACHE_STAT(CALL_FUNCTION, MISSES)
+#define OPCACHE_STAT_CALL_OPT() OPCACHE_STAT(CALL_FUNCTION, OPTS)
+#define OPCACHE_STAT_CALL_DEOPT() OPCACHE_STAT(CALL_FUNCTION, DEOPTS)
 
 
 PyObject* _Py_HOT_FUNCTION
@@ -1592,6 +1655,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
     const _Py_CODEUNIT *next_instr;
     int opcode;        /* Current opcode */
     int oparg;         /* Current opcode argument, if any */
+    int unwind_offset; /* Offset of the instruction raising an exception */
     PyObject **fastlocals, **freevars;
     PyObject *retval = NULL;            /* Return value */
     _Py_atomic_int * const eval_breaker = &tstate->interp->ceval.eval_breaker;
@@ -1674,7 +1738,10 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
     assert(PyBytes_GET_SIZE(co->co_code) <= INT_MAX);
     assert(PyBytes_GET_SIZE(co->co_code) % sizeof(_Py_CODEUNIT) == 0);
     assert(_Py_IS_ALIGNED(PyBytes_AS_STRING(co->co_code), sizeof(_Py_CODEUNIT)));
-    first_instr = (_Py_CODEUNIT *) PyBytes_AS_STRING(co->co_code);
+    first_instr = co->co_quickened;
+    if (first_instr == NULL) {
+        first_instr = (const _Py_CODEUNIT *) PyBytes_AS_STRING(co->co_code);
+    }
     /*
        f->f_lasti refers to the index of the last instruction,
        unless it's -1 in which case next_instr should be first_instr.
@@ -1708,12 +1775,11 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             if (_PyCode_InitOpcache(co) < 0) {
                 goto exit_eval_frame;
             }
-#if OPCACHE_STATS
-            opcache_code_objects_extra_mem +=
-                PyBytes_Size(co->co_code) / sizeof(_Py_CODEUNIT) +
-                sizeof(_PyOpcache) * co->co_opcache_size;
-            opcache_code_objects++;
-#endif
+            if (_PyCode_Quicken(co) < 0) {
+                goto exit_eval_frame;
+            }
+            first_instr = co->co_quickened;
+            next_instr = first_instr + f->f_lasti + 1;
         }
     }
 
@@ -1754,8 +1820,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
 
         if (_Py_atomic_load_relaxed(eval_breaker)) {
             opcode = _Py_OPCODE(*next_instr);
-            if (opcode != SETUP_FINALLY &&
-                opcode != SETUP_WITH &&
+            if (opcode != BEFORE_WITH &&
                 opcode != BEFORE_ASYNC_WITH &&
                 opcode != YIELD_FROM) {
                 /* Few cases where we skip running signal handlers and other
@@ -1764,9 +1829,6 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
                      emitting a resource warning in the common idiom
                      'with open(path) as file:'.
                    - If we're about to enter the 'async with:'.
-                   - If we're about to enter the 'try:' of a try/finally (not
-                     *very* useful, but might help in some cases and it's
-                     traditional)
                    - If we're resuming a chain of nested 'yield from' or
                      'await' calls, then each frame is parked with YIELD_FROM
                      as its next opcode. If the user hit control-C we want to
@@ -1846,6 +1908,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         }
 
         case TARGET(LOAD_FAST): {
+            PREDICTED(LOAD_FAST);
             PyObject *value = GETLOCAL(oparg);
             if (value == NULL) {
                 format_exc_check_arg(tstate, PyExc_UnboundLocalError,
@@ -2096,7 +2159,84 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         case TARGET(BINARY_SUBSCR): {
             PyObject *sub = POP();
             PyObject *container = TOP();
-            PyObject *res = PyObject_GetItem(container, sub);
+            PyTypeObject *type = Py_TYPE(container);
+            PyObject *res;
+
+            OPCACHE_CHECK();
+            if (co_opcache != NULL && co_opcache->optimized > 0) {
+                _PyOpcache_BinarySubscr *bs = &co_opcache->u.bs;
+                if (bs->type == type) {
+                    if (type == &PyList_Type) {
+                        // Fast path for list[int] with a small non-negative index.
+                        if (PyLong_CheckExact(sub) &&
+                            (size_t)Py_SIZE(sub) <= 1)
+                        {
+                            Py_ssize_t i = Py_SIZE(sub) ?
+                                (Py_ssize_t)((PyLongObject *)sub)->ob_digit[0] : 0;
+                            if (i < PyList_GET_SIZE(container)) {
+                                OPCACHE_STAT_SUBSCR_HIT();
+                                res = PyList_GET_ITEM(container, i);
+                                Py_INCREF(res);
+                                Py_DECREF(container);
+                                Py_DECREF(sub);
+                                SET_TOP(res);
+                                DISPATCH();
+                            }
+                        }
+                    }
+                    else if (PyUnicode_CheckExact(sub)) {
+                        // Fast path for dict[str] -- reuse the last entry index.
+                        assert(type == &PyDict_Type);
+                        res = NULL;
+                        Py_ssize_t hint = _PyDict_GetItemHint(
+                            (PyDictObject *)container, sub, bs->hint, &res);
+                        if (res != NULL) {
+                            OPCACHE_STAT_SUBSCR_HIT();
+                            bs->hint = hint;
+                            Py_INCREF(res);
+                            Py_DECREF(container);
+                            Py_DECREF(sub);
+                            SET_TOP(res);
+                            DISPATCH();
+                        }
+                        if (_PyErr_Occurred(tstate)) {
+                            Py_DECREF(container);
+                            Py_DECREF(sub);
+                            SET_TOP(NULL);
+                            goto error;
+                        }
+                        // Missing key: let the slow path raise KeyError.
+                    }
+                }
+                else {
+                    // The container type differs.  Maybe it will stabilize?
+                    OPCACHE_MAYBE_DEOPT_SUBSCR();
+                }
+                OPCACHE_STAT_SUBSCR_MISS();
+            }
+
+            if (co_opcache != NULL) {
+                if ((type == &PyList_Type && PyLong_CheckExact(sub)) ||
+                    (type == &PyDict_Type && PyUnicode_CheckExact(sub)))
+                {
+                    if (co_opcache->optimized == 0) {
+                        // First time we optimize this opcode.
+                        OPCACHE_STAT_SUBSCR_OPT();
+                        co_opcache->optimized = OPCODE_CACHE_MAX_TRIES;
+                    }
+                    if (co_opcache->u.bs.type != type) {
+                        co_opcache->u.bs.type = type;
+                        co_opcache->u.bs.hint = -1;
+                    }
+                }
+                else {
+                    // Neither list[int] nor dict[str]: we don't handle those.
+                    OPCACHE_DEOPT_SUBSCR();
+                }
+            }
+
+            // Slow path.
+            res = PyObject_GetItem(container, sub);
             Py_DECREF(container);
             Py_DECREF(sub);
             SET_TOP(res);
@@ -2424,6 +2564,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         }
 
         case TARGET(RETURN_VALUE): {
+            PREDICTED(RETURN_VALUE);
             retval = POP();
             assert(f->f_iblock == 0);
             assert(EMPTY());
@@ -2685,13 +2826,11 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
-        case TARGET(POP_BLOCK): {
-            PyFrame_BlockPop(f);
-            DISPATCH();
-        }
-
         case TARGET(RERAISE): {
             assert(f->f_iblock > 0);
+            /* The handler is looked up from the RERAISE, but the frame
+               reports the instruction that raised the exception first. */
+            unwind_offset = f->f_lasti;
             if (oparg) {
                 f->f_lasti = f->f_blockstack[f->f_iblock-1].b_handler;
             }
@@ -2700,7 +2839,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             PyObject *tb = POP();
             assert(PyExceptionClass_Check(exc));
             _PyErr_Restore(tstate, exc, val, tb);
-            goto exception_unwind;
+            goto exception_unwind_at;
         }
 
         case TARGET(END_ASYNC_FOR): {
@@ -2851,9 +2990,67 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             PyObject *name = GETITEM(names, oparg);
             PyObject *owner = TOP();
             PyObject *v = SECOND();
+            PyTypeObject *type = Py_TYPE(owner);
             int err;
+
+            OPCACHE_CHECK();
+            if (co_opcache != NULL && co_opcache->optimized > 0) {
+                _PyOpCodeOpt_StoreAttr *sa = &co_opcache->u.sa;
+                if (sa->type == type &&
+                    sa->tp_version_tag == type->tp_version_tag &&
+                    PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))
+                {
+                    if (sa->hint < -1) {
+                        // Fast path for a writable T_OBJECT_EX slot.
+                        PyObject **addr = (PyObject **)((char *)owner + ~sa->hint);
+                        PyObject *old = *addr;
+                        OPCACHE_STAT_STORE_ATTR_HIT();
+                        STACK_SHRINK(2);
+                        *addr = v;  /* steals the reference to v */
+                        Py_XDECREF(old);
+                        Py_DECREF(owner);
+                        DISPATCH();
+                    }
+                    // Fast path for replacing an existing __dict__ entry.
+                    PyObject *dict = *(PyObject **)((char *)owner + type->tp_dictoffset);
+                    if (dict != NULL && PyDict_CheckExact(dict) &&
+                        _PyDict_SetItemHint((PyDictObject *)dict, name,
+                                            sa->hint, v) == 0)
+                    {
+                        OPCACHE_STAT_STORE_ATTR_HIT();
+                        STACK_SHRINK(2);
+                        Py_DECREF(v);
+                        Py_DECREF(owner);
+                        DISPATCH();
+                    }
+                }
+                else {
+                    // The type of the object has either been updated,
+                    // or is different.  Maybe it will stabilize?
+                    OPCACHE_MAYBE_DEOPT_STORE_ATTR();
+                }
+                OPCACHE_STAT_STORE_ATTR_MISS();
+            }
+
+            // Slow path.
             STACK_SHRINK(2);
             err = PyObject_SetAttr(owner, name, v);
+            if (err == 0 && co_opcache != NULL) {
+                Py_ssize_t hint = store_attr_cache_hint(owner, name);
+                if (hint != -1) {
+                    if (co_opcache->optimized == 0) {
+                        // First time we optimize this opcode.
+                        OPCACHE_STAT_STORE_ATTR_OPT();
+                        co_opcache->optimized = OPCODE_CACHE_MAX_TRIES;
+                    }
+                    co_opcache->u.sa.type = type;
+                    co_opcache->u.sa.tp_version_tag = type->tp_version_tag;
+                    co_opcache->u.sa.hint = hint;
+                }
+                else {
+                    OPCACHE_DEOPT_STORE_ATTR();
+                }
+            }
             Py_DECREF(v);
             Py_DECREF(owner);
             if (err != 0)
@@ -3410,6 +3607,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         }
 
         case TARGET(LOAD_ATTR): {
+            PREDICTED(LOAD_ATTR);
             PyObject *name = GETITEM(names, oparg);
             PyObject *owner = TOP();
 
@@ -3419,8 +3617,6 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             PyObject *dict;
             _PyOpCodeOpt_LoadAttr *la;
 
-            OPCACHE_STAT_ATTR_TOTAL();
-
             OPCACHE_CHECK();
             if (co_opcache != NULL && PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG))
             {
@@ -4078,12 +4274,6 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
-        case TARGET(SETUP_FINALLY): {
-            PyFrame_BlockSetup(f, SETUP_FINALLY, INSTR_OFFSET() + oparg,
-                               STACK_LEVEL());
-            DISPATCH();
-        }
-
         case TARGET(BEFORE_ASYNC_WITH): {
             _Py_IDENTIFIER(__aenter__);
             _Py_IDENTIFIER(__aexit__);
@@ -4109,17 +4299,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
-        case TARGET(SETUP_ASYNC_WITH): {
-            PyObject *res = POP();
-            /* Setup the finally block before pushing the result
-               of __aenter__ on the stack. */
-            PyFrame_BlockSetup(f, SETUP_FINALLY, INSTR_OFFSET() + oparg,
-                               STACK_LEVEL());
-            PUSH(res);
-            DISPATCH();
-        }
-
-        case TARGET(SETUP_WITH): {
+        case TARGET(BEFORE_WITH): {
             _Py_IDENTIFIER(__enter__);
             _Py_IDENTIFIER(__exit__);
             PyObject *mgr = TOP();
@@ -4139,15 +4319,20 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             Py_DECREF(enter);
             if (res == NULL)
                 goto error;
-            /* Setup the finally block before pushing the result
-               of __enter__ on the stack. */
-            PyFrame_BlockSetup(f, SETUP_FINALLY, INSTR_OFFSET() + oparg,
-                               STACK_LEVEL());
-
             PUSH(res);
             DISPATCH();
         }
 
+        case TARGET(SETUP_FINALLY):
+        case TARGET(SETUP_WITH):
+        case TARGET(SETUP_ASYNC_WITH):
+        case TARGET(POP_BLOCK): {
+            /* Replaced by the exception table in the compiler */
+            _PyErr_Format(tstate, PyExc_SystemError,
+                          "compiler-only opcode %d in code", opcode);
+            goto error;
+        }
+
         case TARGET(WITH_EXCEPT_START): {
             /* At the top of the stack are 7 values:
                - (TOP, SECOND, THIRD) = exc_info()
@@ -4266,6 +4451,60 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         case TARGET(CALL_FUNCTION): {
             PREDICTED(CALL_FUNCTION);
             PyObject **sp, *res;
+            PyTypeObject *type = Py_TYPE(PEEK(oparg + 1));
+
+            OPCACHE_CHECK();
+            if (co_opcache != NULL && co_opcache->optimized > 0) {
+                if (co_opcache->u.cf.type == type) {
+                    if (!trace_info.cframe.use_tracing) {
+                        // Fast path -- call the cached kind of callable
+                        // through its vectorcall slot directly.
+                        PyObject *func = PEEK(oparg + 1);
+                        vectorcallfunc vectorcall = *(vectorcallfunc *)
+                            ((char *)func + type->tp_vectorcall_offset);
+                        if (vectorcall != NULL) {
+                            OPCACHE_STAT_CALL_HIT();
+                            res = vectorcall(func, stack_pointer - oparg,
+                                             oparg | PY_VECTORCALL_ARGUMENTS_OFFSET,
+                                             NULL);
+                            res = _Py_CheckFunctionResult(tstate, func, res, NULL);
+                            while (oparg-- >= 0) {
+                                PyObject *w = POP();
+                                Py_DECREF(w);
+                            }
+                            PUSH(res);
+                            if (res == NULL) {
+                                goto error;
+                            }
+                            CHECK_EVAL_BREAKER();
+                            DISPATCH();
+                        }
+                    }
+                }
+                else {
+                    // A different kind of callable.  Maybe it will stabilize?
+                    OPCACHE_MAYBE_DEOPT_CALL();
+                }
+                OPCACHE_STAT_CALL_MISS();
+            }
+
+            if (co_opcache != NULL) {
+                if (type == &PyFunction_Type || type == &PyCFunction_Type ||
+                    type == &PyMethod_Type)
+                {
+                    if (co_opcache->optimized == 0) {
+                        // First time we optimize this opcode.
+                        OPCACHE_STAT_CALL_OPT();
+                        co_opcache->optimized = OPCODE_CACHE_MAX_TRIES;
+                    }
+                    co_opcache->u.cf.type = type;
+                }
+                else {
+                    OPCACHE_DEOPT_CALL();
+                }
+            }
+
+            // Slow path.
             sp = stack_pointer;
             res = call_function(tstate, &trace_info, &sp, oparg, NULL);
             stack_pointer = sp;
@@ -4347,6 +4586,15 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
         case TARGET(MAKE_FUNCTION): {
             PyObject *qualname = POP();
             PyObject *codeobj = POP();
+            if (_PyLazyCode_Check(codeobj)) {
+                PyObject *lazy = codeobj;
+                codeobj = _PyCode_LoadLazyConst(co, lazy);
+                Py_DECREF(lazy);
+                if (codeobj == NULL) {
+                    Py_DECREF(qualname);
+                    goto error;
+                }
+            }
             PyFunctionObject *func = (PyFunctionObject *)
                 PyFunction_NewWithQualName(codeobj, f->f_globals, qualname);
 
@@ -4455,6 +4703,78 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        case TARGET(LOAD_FAST__LOAD_FAST): {
+            SUPERINSTRUCTION_FIRST(LOAD_FAST);
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(tstate, PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            SUPERINSTRUCTION_NEXT(LOAD_FAST);
+        }
+
+        case TARGET(LOAD_FAST__LOAD_CONST): {
+            SUPERINSTRUCTION_FIRST(LOAD_FAST);
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(tstate, PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            SUPERINSTRUCTION_NEXT(LOAD_CONST);
+        }
+
+        case TARGET(LOAD_FAST__LOAD_ATTR): {
+            SUPERINSTRUCTION_FIRST(LOAD_FAST);
+            PyObject *value = GETLOCAL(oparg);
+            if (value == NULL) {
+                format_exc_check_arg(tstate, PyExc_UnboundLocalError,
+                                     UNBOUNDLOCAL_ERROR_MSG,
+                                     PyTuple_GetItem(co->co_varnames, oparg));
+                goto error;
+            }
+            Py_INCREF(value);
+            PUSH(value);
+            SUPERINSTRUCTION_NEXT(LOAD_ATTR);
+        }
+
+        case TARGET(LOAD_CONST__LOAD_FAST): {
+            SUPERINSTRUCTION_FIRST(LOAD_CONST);
+            PyObject *value = GETITEM(consts, oparg);
+            Py_INCREF(value);
+            PUSH(value);
+            SUPERINSTRUCTION_NEXT(LOAD_FAST);
+        }
+
+        case TARGET(LOAD_CONST__RETURN_VALUE): {
+            SUPERINSTRUCTION_FIRST(LOAD_CONST);
+            PyObject *value = GETITEM(consts, oparg);
+            Py_INCREF(value);
+            PUSH(value);
+            SUPERINSTRUCTION_NEXT(RETURN_VALUE);
+        }
+
+        case TARGET(STORE_FAST__LOAD_FAST): {
+            SUPERINSTRUCTION_FIRST(STORE_FAST);
+            PyObject *value = POP();
+            SETLOCAL(oparg, value);
+            SUPERINSTRUCTION_NEXT(LOAD_FAST);
+        }
+
+        case TARGET(STORE_FAST__STORE_FAST): {
+            SUPERINSTRUCTION_FIRST(STORE_FAST);
+            PyObject *value = POP();
+            SETLOCAL(oparg, value);
+            SUPERINSTRUCTION_NEXT(STORE_FAST);
+        }
+
         case TARGET(EXTENDED_ARG): {
             int oldoparg = oparg;
             NEXTOPARG();
@@ -4502,22 +4822,38 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
                            tstate, f, &trace_info);
         }
 exception_unwind:
+        unwind_offset = f->f_lasti;
+exception_unwind_at:
         f->f_state = FRAME_UNWINDING;
-        /* Unwind stacks if an exception occurred */
-        while (f->f_iblock > 0) {
-            /* Pop the current block. */
-            PyTryBlock *b = &f->f_blockstack[--f->f_iblock];
-
-            if (b->b_type == EXCEPT_HANDLER) {
+        {
+            _PyExceptionTableEntry entry;
+            if (!_PyCode_FindExceptionHandler(co, unwind_offset, &entry)) {
+                /* No handler in this frame: drop the exceptions being
+                   handled and propagate the exception. */
+                while (f->f_iblock > 0) {
+                    PyTryBlock *b = &f->f_blockstack[--f->f_iblock];
+                    assert(b->b_type == EXCEPT_HANDLER);
+                    UNWIND_EXCEPT_HANDLER(b);
+                }
+                break;
+            }
+            /* Leave the handlers that the exception escapes from, but not
+               those the new handler is nested in. */
+            while (f->f_iblock > 0 &&
+                   f->f_blockstack[f->f_iblock-1].b_level >= entry.level) {
+                PyTryBlock *b = &f->f_blockstack[--f->f_iblock];
+                assert(b->b_type == EXCEPT_HANDLER);
                 UNWIND_EXCEPT_HANDLER(b);
-                continue;
             }
-            UNWIND_BLOCK(b);
-            if (b->b_type == SETUP_FINALLY) {
+            assert(STACK_LEVEL() >= entry.level);
+            while (STACK_LEVEL() > entry.level) {
+                PyObject *v = POP();
+                Py_XDECREF(v);
+            }
+            {
                 PyObject *exc, *val, *tb;
-                int handler = b->b_handler;
+                int handler = entry.handler;
                 _PyErr_StackItem *exc_info = tstate->exc_info;
-                /* Beware, this invalidates all b->b_* fields */
                 PyFrame_BlockSetup(f, EXCEPT_HANDLER, f->f_lasti, STACK_LEVEL());
                 PUSH(exc_info->exc_traceback);
                 PUSH(exc_info->exc_value);
@@ -4557,7 +4893,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
                 f->f_state = FRAME_EXECUTING;
                 goto main_loop;
             }
-        } /* unwind stack */
+        }
 
         /* End the loop as we still have an error */
         break;
@@ -5910,6 +6246,53 @@ trace_call_function(PyThreadState *tstate,
     return PyObject_Vectorcall(func, args, nargs | PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
 }
 
+/* Return the STORE_ATTR opcache hint for a successful generic store of
+   'name' on 'owner': an inverted slot offset (< -1) for a writable
+   T_OBJECT_EX member, or the entry index (>= 0) in an exact instance dict.
+   Return -1 if the store can't be cached. */
+static Py_ssize_t
+store_attr_cache_hint(PyObject *owner, PyObject *name)
+{
+    PyTypeObject *type = Py_TYPE(owner);
+    if (type->tp_setattro != PyObject_GenericSetAttr) {
+        return -1;
+    }
+    PyObject *descr = _PyType_Lookup(type, name);
+    if (!PyType_HasFeature(type, Py_TPFLAGS_VALID_VERSION_TAG)) {
+        return -1;
+    }
+    if (descr != NULL) {
+        if (!Py_IS_TYPE(descr, &PyMemberDescr_Type)) {
+            // Some other kind of descriptor that we don't handle.
+            return -1;
+        }
+        PyMemberDescrObject *member = (PyMemberDescrObject *)descr;
+        struct PyMemberDef *dmem = member->d_member;
+        if (dmem->type != T_OBJECT_EX || (dmem->flags & READONLY) ||
+            !PyObject_TypeCheck(owner, PyDescr_TYPE(member)))
+        {
+            return -1;
+        }
+        assert(dmem->offset > 0);
+        return ~dmem->offset;
+    }
+    if (type->tp_dictoffset <= 0) {
+        return -1;
+    }
+    PyObject *dict = *(PyObject **)((char *)owner + type->tp_dictoffset);
+    if (dict == NULL || !PyDict_CheckExact(dict) || !PyUnicode_CheckExact(name)) {
+        return -1;
+    }
+    PyObject *value = NULL;
+    Py_ssize_t hint = _PyDict_GetItemHint((PyDictObject *)dict, name, -1, &value);
+    if (value == NULL) {
+        PyErr_Clear();
+        return -1;
+    }
+    assert(hint >= 0);
+    return hint;
+}
+
 /* Issue #29227: Inline call_function() into _PyEval_EvalFrameDefault()
    to reduce the stack consumption. */
 Py_LOCAL_INLINE(PyObject *) _Py_HOT_FUNCTION
@@ -6392,6 +6775,8 @@ unicode_concatenate(PyThreadState *tstate, PyObject *v, PyObject *w,
         NEXTOPARG();
         switch (opcode) {
         case STORE_FAST:
+        case STORE_FAST__LOAD_FAST:
+        case STORE_FAST__STORE_FAST:
         {
             PyObject **fastlocals = f->f_localsplus;
             if (GETLOCAL(oparg) == v)
@@ -233,6 +233,40 @@ _imp_is_frozen_package(PyObject *module, PyObject *arg)
     return return_value;
 }
 
+PyDoc_STRVAR(_imp__is_frozen_stdlib__doc__,
+"_is_frozen_stdlib($module, name, /)\n"
+"--\n"
+"\n"
+"Returns True if the module name is of a frozen standard library module.\n"
+"\n"
+"The module is then also in the directory sys._stdlib_dir.");
+
+#define _IMP__IS_FROZEN_STDLIB_METHODDEF    \
+    {"_is_frozen_stdlib", (PyCFunction)_imp__is_frozen_stdlib, METH_O, _imp__is_frozen_stdlib__doc__},
+
+static PyObject *
+_imp__is_frozen_stdlib_impl(PyObject *module, PyObject *name);
+
+static PyObject *
+_imp__is_frozen_stdlib(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    PyObject *name;
+
+    if (!PyUnicode_Check(arg)) {
+        _PyArg_BadArgument("_is_frozen_stdlib", "argument", "str", arg);
+        goto exit;
+    }
+    if (PyUnicode_READY(arg) == -1) {
+        goto exit;
+    }
+    name = arg;
+    return_value = _imp__is_frozen_stdlib_impl(module, name);
+
+exit:
+    return return_value;
+}
+
 PyDoc_STRVAR(_imp_is_builtin__doc__,
 "is_builtin($module, name, /)\n"
 "--\n"
@@ -449,4 +483,4 @@ _imp_source_hash(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyOb
 #ifndef _IMP_EXEC_DYNAMIC_METHODDEF
     #define _IMP_EXEC_DYNAMIC_METHODDEF
 #endif /* !defined(_IMP_EXEC_DYNAMIC_METHODDEF) */
-/*[clinic end generated code: output=7c31c433af88af6b input=a9049054013a1b77]*/
+/*[clinic end generated code: output=74a4fe0f4db3a011 input=a9049054013a1b77]*/
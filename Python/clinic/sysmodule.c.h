@@ -956,6 +956,73 @@ sys__deactivate_opcache(PyObject *module, PyObject *Py_UNUSED(ignored))
     return sys__deactivate_opcache_impl(module);
 }
 
+PyDoc_STRVAR(sys__set_opcache_stats__doc__,
+"_set_opcache_stats($module, enable, /)\n"
+"--\n"
+"\n"
+"Enable or disable collecting opcode cache statistics.\n"
+"\n"
+"Counters are kept both globally and per code object; see\n"
+"sys._opcache_stats().");
+
+#define SYS__SET_OPCACHE_STATS_METHODDEF    \
+    {"_set_opcache_stats", (PyCFunction)sys__set_opcache_stats, METH_O, sys__set_opcache_stats__doc__},
+
+static PyObject *
+sys__set_opcache_stats_impl(PyObject *module, int enable);
+
+static PyObject *
+sys__set_opcache_stats(PyObject *module, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    int enable;
+
+    enable = PyObject_IsTrue(arg);
+    if (enable < 0) {
+        goto exit;
+    }
+    return_value = sys__set_opcache_stats_impl(module, enable);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(sys__opcache_stats__doc__,
+"_opcache_stats($module, code=None, /)\n"
+"--\n"
+"\n"
+"Return opcode cache statistics collected since sys._set_opcache_stats(True).\n"
+"\n"
+"The result maps each cached opcode name to a dict of its \"opts\", \"hits\",\n"
+"\"misses\" and \"deopts\" counters.  Without argument, return the totals for\n"
+"all code objects; otherwise return the counters of the given code object.");
+
+#define SYS__OPCACHE_STATS_METHODDEF    \
+    {"_opcache_stats", (PyCFunction)(void(*)(void))sys__opcache_stats, METH_FASTCALL, sys__opcache_stats__doc__},
+
+static PyObject *
+sys__opcache_stats_impl(PyObject *module, PyObject *code);
+
+static PyObject *
+sys__opcache_stats(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyObject *return_value = NULL;
+    PyObject *code = Py_None;
+
+    if (!_PyArg_CheckPositional("_opcache_stats", nargs, 0, 1)) {
+        goto exit;
+    }
+    if (nargs < 1) {
+        goto skip_optional;
+    }
+    code = args[0];
+skip_optional:
+    return_value = sys__opcache_stats_impl(module, code);
+
+exit:
+    return return_value;
+}
+
 #ifndef SYS_GETWINDOWSVERSION_METHODDEF
     #define SYS_GETWINDOWSVERSION_METHODDEF
 #endif /* !defined(SYS_GETWINDOWSVERSION_METHODDEF) */
@@ -983,4 +1050,4 @@ sys__deactivate_opcache(PyObject *module, PyObject *Py_UNUSED(ignored))
 #ifndef SYS_GETANDROIDAPILEVEL_METHODDEF
     #define SYS_GETANDROIDAPILEVEL_METHODDEF
 #endif /* !defined(SYS_GETANDROIDAPILEVEL_METHODDEF) */
-/*[clinic end generated code: output=68c62b9ca317a0c8 input=a9049054013a1b77]*/
+/*[clinic end generated code: output=217fff8fdbb6a92b input=a9049054013a1b77]*/
@@ -23,6 +23,7 @@
 
 #include "Python.h"
 #include "pycore_ast.h"           // _PyAST_GetDocString()
+#include "pycore_code.h"          // _PyCode_NewWithExceptionTable()
 #include "pycore_compile.h"       // _PyFuture_FromAST()
 #include "pycore_pymem.h"         // _PyMem_IsPtrFreed()
 #include "pycore_long.h"          // _PyLong_GetZero()
@@ -75,6 +76,8 @@ struct instr {
     unsigned char i_opcode;
     int i_oparg;
     struct basicblock_ *i_target; /* target block (if jump instruction) */
+    struct basicblock_ *i_except; /* innermost exception handler, set by
+                                     label_exception_targets() */
     int i_lineno;
 };
 
@@ -126,6 +129,10 @@ typedef struct basicblock_ {
     unsigned b_nofallthrough : 1;
     /* Basic block exits scope (it ends with a return or raise) */
     unsigned b_exit : 1;
+    /* Basic block has been reached by label_exception_targets() */
+    unsigned b_visited : 1;
+    /* Handlers active on entry, used by label_exception_targets() */
+    struct _except_stack *b_exceptstack;
     /* depth of stack upon entry of block, computed by stackdepth() */
     int b_startdepth;
     /* instruction offset for block, computed by assemble_jump_offsets() */
@@ -183,6 +190,12 @@ struct compiler_unit {
 
     PyObject *u_private;        /* for private name mangling */
 
+    /* Symbol table entry of the comprehension being compiled inline into
+       this unit and the map of its local names to hidden fast locals,
+       see compiler_inline_comprehension(). */
+    PySTEntryObject *u_inline_ste;
+    PyObject *u_inline_names;
+
     Py_ssize_t u_argcount;        /* number of arguments for block */
     Py_ssize_t u_posonlyargcount;        /* number of positional only arguments for block */
     Py_ssize_t u_kwonlyargcount; /* number of keyword only arguments for block */
@@ -657,6 +670,8 @@ compiler_enter_scope(struct compiler *c, identifier name,
     }
 
     u->u_private = NULL;
+    u->u_inline_ste = NULL;
+    u->u_inline_names = NULL;
 
     /* Push the old compiler_unit on the stack. */
     if (c->u) {
@@ -1014,6 +1029,8 @@ stack_effect(int opcode, int oparg, int jump)
              * Restore the stack position and push 6 values before jumping to
              * the handler if an exception be raised. */
             return jump ? 6 : 1;
+        case BEFORE_WITH:
+            return 1;
         case RETURN_VALUE:
             return -1;
         case IMPORT_STAR:
@@ -3654,6 +3671,33 @@ compiler_nameop(struct compiler *c, identifier name, expr_context_ty ctx)
     op = 0;
     optype = OP_NAME;
     scope = _PyST_GetScope(c->u->u_ste, mangled);
+    if (c->u->u_inline_ste != NULL) {
+        /* Locals of an inlined comprehension live in hidden fast locals,
+           its globals stay globals, anything else is resolved as in the
+           enclosing function. */
+        PyObject *hidden = PyDict_GetItemWithError(c->u->u_inline_names,
+                                                   mangled);
+        if (hidden != NULL) {
+            Py_DECREF(mangled);
+            switch (ctx) {
+            case Load: op = LOAD_FAST; break;
+            case Store: op = STORE_FAST; break;
+            case Del: op = DELETE_FAST; break;
+            }
+            Py_INCREF(hidden);
+            ADDOP_N(c, op, hidden, varnames);
+            return 1;
+        }
+        if (PyErr_Occurred()) {
+            Py_DECREF(mangled);
+            return 0;
+        }
+        int inline_scope = _PyST_GetScope(c->u->u_inline_ste, mangled);
+        if (inline_scope == GLOBAL_IMPLICIT ||
+            inline_scope == GLOBAL_EXPLICIT) {
+            scope = inline_scope;
+        }
+    }
     switch (scope) {
     case FREE:
         dict = c->u->u_freevars;
@@ -4551,9 +4595,12 @@ compiler_sync_comprehension_generator(struct compiler *c,
     gen = (comprehension_ty)asdl_seq_GET(generators, gen_index);
 
     if (gen_index == 0) {
-        /* Receive outermost iter as an implicit argument */
-        c->u->u_argcount = 1;
-        ADDOP_I(c, LOAD_FAST, 0);
+        /* Receive outermost iter as an implicit argument, an inlined
+           comprehension already has it on the stack */
+        if (c->u->u_inline_ste == NULL) {
+            c->u->u_argcount = 1;
+            ADDOP_I(c, LOAD_FAST, 0);
+        }
     }
     else {
         /* Sub-iter - calculate on the fly */
@@ -4743,6 +4790,131 @@ compiler_async_comprehension_generator(struct compiler *c,
     return 1;
 }
 
+/* Return the symbol table entry of the list, set or dict comprehension e
+   if it can be compiled inline into the current function instead of into
+   a function of its own.  That is the case when it is synchronous and
+   contains no nested scopes, so that none of its locals can be captured.
+   Return NULL with no exception set otherwise.
+*/
+static PySTEntryObject *
+compiler_inlinable_comprehension(struct compiler *c, expr_ty e,
+                                 comprehension_ty outermost)
+{
+    PySTEntryObject *ste;
+
+    if (c->u->u_ste->ste_type != FunctionBlock ||
+        c->u->u_inline_ste != NULL || outermost->is_async) {
+        return NULL;
+    }
+    ste = PySymtable_Lookup(c->c_st, (void *)e);
+    if (ste == NULL) {
+        return NULL;
+    }
+    if (ste->ste_coroutine || ste->ste_generator ||
+        PyList_GET_SIZE(ste->ste_children) != 0) {
+        Py_DECREF(ste);
+        return NULL;
+    }
+    return ste;
+}
+
+static int
+compiler_inline_comprehension_body(struct compiler *c, int type,
+                                   asdl_comprehension_seq *generators,
+                                   expr_ty elt, expr_ty val,
+                                   PySTEntryObject *ste, PyObject *names)
+{
+    comprehension_ty outermost;
+    PyObject *name, *hidden;
+    Py_ssize_t pos = 0;
+    int res;
+
+    outermost = (comprehension_ty) asdl_seq_GET(generators, 0);
+    switch (type) {
+    case COMP_LISTCOMP:
+        ADDOP_I(c, BUILD_LIST, 0);
+        break;
+    case COMP_SETCOMP:
+        ADDOP_I(c, BUILD_SET, 0);
+        break;
+    case COMP_DICTCOMP:
+        ADDOP_I(c, BUILD_MAP, 0);
+        break;
+    default:
+        PyErr_Format(PyExc_SystemError,
+                     "unknown comprehension type %d", type);
+        return 0;
+    }
+
+    /* The outermost iterable is evaluated in the enclosing scope */
+    VISIT(c, expr, outermost->iter);
+    ADDOP(c, GET_ITER);
+
+    c->u->u_inline_ste = ste;
+    c->u->u_inline_names = names;
+    res = compiler_comprehension_generator(c, generators, 0, 0, elt,
+                                           val, type);
+    c->u->u_inline_ste = NULL;
+    c->u->u_inline_names = NULL;
+    if (!res) {
+        return 0;
+    }
+
+    /* Leave the hidden locals unbound, as they were before */
+    while (PyDict_Next(names, &pos, &name, &hidden)) {
+        ADDOP_LOAD_CONST(c, Py_None);
+        Py_INCREF(hidden);
+        ADDOP_N(c, STORE_FAST, hidden, varnames);
+        Py_INCREF(hidden);
+        ADDOP_N(c, DELETE_FAST, hidden, varnames);
+    }
+    return 1;
+}
+
+/* Compile the comprehension described by ste into the current function
+   rather than into a nested function called once.  Its local variables,
+   other than the implicit ".0" argument, become fast locals of the
+   function named with a leading dot, so they can't clash with its own.
+*/
+static int
+compiler_inline_comprehension(struct compiler *c, int type,
+                              asdl_comprehension_seq *generators,
+                              expr_ty elt, expr_ty val,
+                              PySTEntryObject *ste)
+{
+    PyObject *names, *name, *flags;
+    Py_ssize_t pos = 0;
+    int res;
+
+    names = PyDict_New();
+    if (names == NULL) {
+        return 0;
+    }
+    while (PyDict_Next(ste->ste_symbols, &pos, &name, &flags)) {
+        PyObject *hidden;
+        if (_PyST_GetScope(ste, name) != LOCAL ||
+            _PyUnicode_EqualToASCIIString(name, ".0")) {
+            continue;
+        }
+        hidden = PyUnicode_FromFormat(".%U", name);
+        if (hidden == NULL) {
+            Py_DECREF(names);
+            return 0;
+        }
+        PyUnicode_InternInPlace(&hidden);
+        if (PyDict_SetItem(names, name, hidden) < 0) {
+            Py_DECREF(hidden);
+            Py_DECREF(names);
+            return 0;
+        }
+        Py_DECREF(hidden);
+    }
+    res = compiler_inline_comprehension_body(c, type, generators, elt, val,
+                                             ste, names);
+    Py_DECREF(names);
+    return res;
+}
+
 static int
 compiler_comprehension(struct compiler *c, expr_ty e, int type,
                        identifier name, asdl_comprehension_seq *generators, expr_ty elt,
@@ -4758,6 +4930,19 @@ compiler_comprehension(struct compiler *c, expr_ty e, int type,
     int is_async_function = c->u->u_ste->ste_coroutine;
 
     outermost = (comprehension_ty) asdl_seq_GET(generators, 0);
+    if (type != COMP_GENEXP) {
+        PySTEntryObject *ste;
+        ste = compiler_inlinable_comprehension(c, e, outermost);
+        if (ste != NULL) {
+            int res = compiler_inline_comprehension(c, type, generators,
+                                                    elt, val, ste);
+            Py_DECREF(ste);
+            return res;
+        }
+        if (PyErr_Occurred()) {
+            return 0;
+        }
+    }
     if (!compiler_enter_scope(c, name, COMPILER_SCOPE_COMPREHENSION,
                               (void *)e, e->lineno))
     {
@@ -6323,6 +6508,8 @@ struct assembler {
     int a_prevlineno;     /* lineno of last emitted line in line table */
     int a_lineno;          /* lineno of last emitted instruction */
     int a_lineno_start;    /* bytecode start offset of current lineno */
+    PyObject *a_except_table;  /* bytes containing exception table */
+    int a_except_table_off;    /* offset into exception table */
     basicblock *a_entry;
 };
 
@@ -6428,6 +6615,10 @@ assemble_init(struct assembler *a, int nblocks, int firstlineno)
     if (a->a_lnotab == NULL) {
         goto error;
     }
+    a->a_except_table = PyBytes_FromStringAndSize(NULL, DEFAULT_LNOTAB_SIZE);
+    if (a->a_except_table == NULL) {
+        goto error;
+    }
     if ((size_t)nblocks > SIZE_MAX / sizeof(basicblock *)) {
         PyErr_NoMemory();
         goto error;
@@ -6436,6 +6627,7 @@ assemble_init(struct assembler *a, int nblocks, int firstlineno)
 error:
     Py_XDECREF(a->a_bytecode);
     Py_XDECREF(a->a_lnotab);
+    Py_XDECREF(a->a_except_table);
     return 0;
 }
 
@@ -6444,6 +6636,7 @@ assemble_free(struct assembler *a)
 {
     Py_XDECREF(a->a_bytecode);
     Py_XDECREF(a->a_lnotab);
+    Py_XDECREF(a->a_except_table);
 }
 
 static int
@@ -6560,6 +6753,73 @@ assemble_emit(struct assembler *a, struct instr *i)
     return 1;
 }
 
+static int
+assemble_emit_exception_table_item(struct assembler *a, int value)
+{
+    Py_ssize_t len = PyBytes_GET_SIZE(a->a_except_table);
+    unsigned char *table;
+
+    assert(value >= 0);
+    /* An int takes at most 5 bytes */
+    if (a->a_except_table_off + 5 >= len) {
+        if (_PyBytes_Resize(&a->a_except_table, len * 2) < 0) {
+            return 0;
+        }
+    }
+    table = (unsigned char *)PyBytes_AS_STRING(a->a_except_table);
+    while (value >= 128) {
+        table[a->a_except_table_off++] = (value & 127) | 128;
+        value >>= 7;
+    }
+    table[a->a_except_table_off++] = value;
+    return 1;
+}
+
+static int
+assemble_emit_exception_table_entry(struct assembler *a, int start, int end,
+                                    basicblock *handler)
+{
+    /* The handler is entered with the 6 values pushed by the unwinding
+       on top of the stack of its try statement, see stack_effect(). */
+    int level = handler->b_startdepth - 6;
+    assert(level >= 0);
+    return (assemble_emit_exception_table_item(a, start) &&
+            assemble_emit_exception_table_item(a, end - start) &&
+            assemble_emit_exception_table_item(a, handler->b_offset) &&
+            assemble_emit_exception_table_item(a, level));
+}
+
+/* Write the exception table: one entry for each run of instructions with
+   the same innermost handler.  See Objects/exception_handling_notes.txt. */
+static int
+assemble_exception_table(struct assembler *a)
+{
+    basicblock *handler = NULL;
+    int start = -1, ioffset = 0;
+
+    for (basicblock *b = a->a_entry; b != NULL; b = b->b_next) {
+        ioffset = b->b_offset;
+        for (int i = 0; i < b->b_iused; i++) {
+            struct instr *instr = &b->b_instr[i];
+            if (instr->i_except != handler) {
+                if (handler != NULL &&
+                    !assemble_emit_exception_table_entry(a, start, ioffset,
+                                                         handler)) {
+                    return 0;
+                }
+                start = ioffset;
+                handler = instr->i_except;
+            }
+            ioffset += instrsize(instr->i_oparg);
+        }
+    }
+    if (handler != NULL &&
+        !assemble_emit_exception_table_entry(a, start, ioffset, handler)) {
+        return 0;
+    }
+    return 1;
+}
+
 static void
 assemble_jump_offsets(struct assembler *a, struct compiler *c)
 {
@@ -6725,7 +6985,8 @@ merge_const_one(struct compiler *c, PyObject **obj)
 }
 
 static PyCodeObject *
-makecode(struct compiler *c, struct assembler *a, PyObject *consts)
+makecode(struct compiler *c, struct assembler *a, PyObject *consts,
+         int maxdepth)
 {
     PyCodeObject *co = NULL;
     PyObject *names = NULL;
@@ -6736,7 +6997,7 @@ makecode(struct compiler *c, struct assembler *a, PyObject *consts)
     Py_ssize_t nlocals;
     int nlocals_int;
     int flags;
-    int posorkeywordargcount, posonlyargcount, kwonlyargcount, maxdepth;
+    int posorkeywordargcount, posonlyargcount, kwonlyargcount;
 
     names = dict_keys_inorder(c->u->u_names, 0);
     varnames = dict_keys_inorder(c->u->u_varnames, 0);
@@ -6778,11 +7039,6 @@ makecode(struct compiler *c, struct assembler *a, PyObject *consts)
     posonlyargcount = Py_SAFE_DOWNCAST(c->u->u_posonlyargcount, Py_ssize_t, int);
     posorkeywordargcount = Py_SAFE_DOWNCAST(c->u->u_argcount, Py_ssize_t, int);
     kwonlyargcount = Py_SAFE_DOWNCAST(c->u->u_kwonlyargcount, Py_ssize_t, int);
-    maxdepth = stackdepth(c);
-    if (maxdepth < 0) {
-        Py_DECREF(consts);
-        goto error;
-    }
     if (maxdepth > MAX_ALLOWED_STACK_USE) {
         PyErr_Format(PyExc_SystemError,
                      "excessive stack use: stack is %d deep",
@@ -6790,11 +7046,13 @@ makecode(struct compiler *c, struct assembler *a, PyObject *consts)
         Py_DECREF(consts);
         goto error;
     }
-    co = PyCode_NewWithPosOnlyArgs(posonlyargcount+posorkeywordargcount,
-                                   posonlyargcount, kwonlyargcount, nlocals_int,
-                                   maxdepth, flags, a->a_bytecode, consts, names,
-                                   varnames, freevars, cellvars, c->c_filename,
-                                   c->u->u_name, c->u->u_firstlineno, a->a_lnotab);
+    co = _PyCode_NewWithExceptionTable(posonlyargcount+posorkeywordargcount,
+                                       posonlyargcount, kwonlyargcount,
+                                       nlocals_int, maxdepth, flags,
+                                       a->a_bytecode, consts, names, varnames,
+                                       freevars, cellvars, c->c_filename,
+                                       c->u->u_name, c->u->u_firstlineno,
+                                       a->a_lnotab, a->a_except_table);
     Py_DECREF(consts);
  error:
     Py_XDECREF(names);
@@ -6884,12 +7142,202 @@ insert_generator_prefix(struct compiler *c, basicblock *entryblock) {
     return 0;
 }
 
+/* The exception handlers active at some point of the control flow graph,
+   innermost last.  handlers[0] is NULL so that the top of an empty stack
+   means no handler. */
+typedef struct _except_stack {
+    basicblock *handlers[CO_MAXBLOCKS+1];
+    int depth;
+} ExceptStack;
+
+static ExceptStack *
+make_except_stack(void)
+{
+    ExceptStack *stack = (ExceptStack *)PyMem_Malloc(sizeof(ExceptStack));
+    if (stack == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    stack->depth = 0;
+    stack->handlers[0] = NULL;
+    return stack;
+}
+
+static ExceptStack *
+copy_except_stack(ExceptStack *stack)
+{
+    ExceptStack *copy = (ExceptStack *)PyMem_Malloc(sizeof(ExceptStack));
+    if (copy == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    memcpy(copy, stack, sizeof(ExceptStack));
+    return copy;
+}
+
+static int
+is_block_push(struct instr *instr)
+{
+    int opcode = instr->i_opcode;
+    return opcode == SETUP_FINALLY || opcode == SETUP_WITH ||
+           opcode == SETUP_ASYNC_WITH;
+}
+
+static int
+push_except_target(basicblock ***sp, basicblock *target, ExceptStack *stack)
+{
+    if (target->b_visited) {
+        return 0;
+    }
+    target->b_exceptstack = copy_except_stack(stack);
+    if (target->b_exceptstack == NULL) {
+        return -1;
+    }
+    target->b_visited = 1;
+    *(*sp)++ = target;
+    return 0;
+}
+
+/* Set i_except of every instruction to the innermost exception handler
+   covering it, following the block instructions (SETUP_FINALLY, SETUP_WITH,
+   SETUP_ASYNC_WITH and POP_BLOCK) along the control flow graph.
+*/
+static int
+label_exception_targets(basicblock *entry)
+{
+    int nblocks = 0;
+    for (basicblock *b = entry; b != NULL; b = b->b_next) {
+        b->b_visited = 0;
+        b->b_exceptstack = NULL;
+        for (int i = 0; i < b->b_iused; i++) {
+            b->b_instr[i].i_except = NULL;
+        }
+        nblocks++;
+    }
+    basicblock **todo_stack = PyMem_New(basicblock *, nblocks);
+    if (todo_stack == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    basicblock **todo = todo_stack;
+    entry->b_exceptstack = make_except_stack();
+    if (entry->b_exceptstack == NULL) {
+        goto error;
+    }
+    entry->b_visited = 1;
+    *todo++ = entry;
+    while (todo > todo_stack) {
+        basicblock *b = *--todo;
+        ExceptStack *except_stack = b->b_exceptstack;
+        b->b_exceptstack = NULL;
+        basicblock *handler = except_stack->handlers[except_stack->depth];
+        for (int i = 0; i < b->b_iused; i++) {
+            struct instr *instr = &b->b_instr[i];
+            if (is_block_push(instr)) {
+                /* The handler runs with the handlers that were active
+                   before the block was set up. */
+                if (push_except_target(&todo, instr->i_target,
+                                       except_stack) < 0) {
+                    PyMem_Free(except_stack);
+                    goto error;
+                }
+                if (except_stack->depth == CO_MAXBLOCKS) {
+                    PyErr_SetString(PyExc_SystemError,
+                                    "too many nested exception handlers");
+                    PyMem_Free(except_stack);
+                    goto error;
+                }
+                instr->i_except = handler;
+                handler = instr->i_target;
+                except_stack->handlers[++except_stack->depth] = handler;
+            }
+            else if (instr->i_opcode == POP_BLOCK) {
+                assert(except_stack->depth > 0);
+                handler = except_stack->handlers[--except_stack->depth];
+                instr->i_except = handler;
+            }
+            else {
+                if (is_jump(instr) &&
+                    push_except_target(&todo, instr->i_target,
+                                       except_stack) < 0) {
+                    PyMem_Free(except_stack);
+                    goto error;
+                }
+                instr->i_except = handler;
+            }
+        }
+        if (!b->b_nofallthrough && b->b_next != NULL &&
+            !b->b_next->b_visited) {
+            b->b_next->b_exceptstack = except_stack;
+            b->b_next->b_visited = 1;
+            *todo++ = b->b_next;
+        }
+        else {
+            PyMem_Free(except_stack);
+        }
+    }
+    PyMem_Free(todo_stack);
+    return 0;
+
+error:
+    while (todo > todo_stack) {
+        basicblock *b = *--todo;
+        PyMem_Free(b->b_exceptstack);
+        b->b_exceptstack = NULL;
+    }
+    PyMem_Free(todo_stack);
+    return -1;
+}
+
+static void
+clean_basic_block(basicblock *bb, int prev_lineno);
+
+static int
+eliminate_unused_handlers(struct assembler *a);
+
+/* Once the exception table is known, drop the block instructions from the
+   code: SETUP_WITH becomes BEFORE_WITH, the others NOPs which are removed
+   unless they are needed for their line number.
+*/
+static void
+convert_exception_handlers_to_nops(basicblock *entry)
+{
+    for (basicblock *b = entry; b != NULL; b = b->b_next) {
+        for (int i = 0; i < b->b_iused; i++) {
+            struct instr *instr = &b->b_instr[i];
+            switch (instr->i_opcode) {
+            case SETUP_WITH:
+                instr->i_opcode = BEFORE_WITH;
+                instr->i_oparg = 0;
+                instr->i_target = NULL;
+                break;
+            case SETUP_FINALLY:
+            case SETUP_ASYNC_WITH:
+            case POP_BLOCK:
+                instr->i_opcode = NOP;
+                instr->i_oparg = 0;
+                instr->i_target = NULL;
+                break;
+            }
+        }
+    }
+    basicblock *pred = NULL;
+    for (basicblock *b = entry; b != NULL; b = b->b_next) {
+        int prev_lineno = -1;
+        if (pred && pred->b_iused) {
+            prev_lineno = pred->b_instr[pred->b_iused-1].i_lineno;
+        }
+        clean_basic_block(b, prev_lineno);
+        pred = b->b_nofallthrough ? NULL : b;
+    }
+}
+
 static PyCodeObject *
 assemble(struct compiler *c, int addNone)
 {
     basicblock *b, *entryblock;
     struct assembler a;
-    int j, nblocks;
+    int j, nblocks, maxdepth;
     PyCodeObject *co = NULL;
     PyObject *consts = NULL;
 
@@ -6947,6 +7395,20 @@ assemble(struct compiler *c, int addNone)
         goto error;
     }
 
+    /* The stack depth of handlers is needed for the exception table, and
+       can't be computed once the block instructions are gone. */
+    maxdepth = stackdepth(c);
+    if (maxdepth < 0) {
+        goto error;
+    }
+    if (label_exception_targets(entryblock)) {
+        goto error;
+    }
+    convert_exception_handlers_to_nops(entryblock);
+    if (eliminate_unused_handlers(&a)) {
+        goto error;
+    }
+
     /* Can't modify the bytecode after computing jump offsets. */
     assemble_jump_offsets(&a, c);
 
@@ -6959,6 +7421,9 @@ assemble(struct compiler *c, int addNone)
     if (!assemble_line_range(&a)) {
         return 0;
     }
+    if (!assemble_exception_table(&a)) {
+        goto error;
+    }
 
     if (_PyBytes_Resize(&a.a_lnotab, a.a_lnotab_off) < 0) {
         goto error;
@@ -6966,6 +7431,12 @@ assemble(struct compiler *c, int addNone)
     if (!merge_const_one(c, &a.a_lnotab)) {
         goto error;
     }
+    if (_PyBytes_Resize(&a.a_except_table, a.a_except_table_off) < 0) {
+        goto error;
+    }
+    if (!merge_const_one(c, &a.a_except_table)) {
+        goto error;
+    }
     if (_PyBytes_Resize(&a.a_bytecode, a.a_offset * sizeof(_Py_CODEUNIT)) < 0) {
         goto error;
     }
@@ -6973,7 +7444,7 @@ assemble(struct compiler *c, int addNone)
         goto error;
     }
 
-    co = makecode(c, &a, consts);
+    co = makecode(c, &a, consts, maxdepth);
  error:
     Py_XDECREF(consts);
     assemble_free(&a);
@@ -7068,6 +7539,135 @@ eliminate_jump_to_jump(basicblock *bb, int opcode) {
 /* Maximum size of basic block that should be copied in optimizer */
 #define MAX_COPY_SIZE 4
 
+/* State of a fast local during optimize_fast_locals().  Each field is only
+   valid while its *_seg field equals the current segment. */
+struct local_state {
+    int const_seg;      /* The local holds the constant const_index */
+    int const_index;
+    int bound_seg;      /* The local is bound */
+    int store_seg;      /* store_index is the last STORE_FAST to the local */
+    int store_index;
+};
+
+/* Instructions which can neither raise nor run arbitrary code, so that
+   nothing can observe the value of a local while they execute. */
+static int
+is_unobservable(int opcode)
+{
+    switch (opcode) {
+        case NOP:
+        case LOAD_CONST:
+        case STORE_FAST:
+        case POP_TOP:
+        case ROT_TWO:
+        case ROT_THREE:
+        case ROT_FOUR:
+        case DUP_TOP:
+        case DUP_TOP_TWO:
+            return 1;
+    }
+    return 0;
+}
+
+/* Dataflow over the fast locals of a basic block.
+
+   The block is split into segments of consecutive instructions with the
+   same line number: a trace function may rebind or delete locals through
+   frame.f_locals at each line event, so nothing is known about a local at
+   the start of a segment.  Within a segment:
+
+   - LOAD_FAST x of a local stored from LOAD_CONST c becomes LOAD_CONST c;
+   - LOAD_FAST x; STORE_FAST x of a bound local becomes NOP; NOP;
+   - STORE_FAST x overwritten by another STORE_FAST x with only
+     unobservable instructions in between becomes POP_TOP.
+*/
+static int
+optimize_fast_locals(struct compiler *c, basicblock *entry)
+{
+    Py_ssize_t nlocals = PyDict_GET_SIZE(c->u->u_varnames);
+    if (nlocals == 0) {
+        return 0;
+    }
+    struct local_state *locals = PyMem_Calloc(nlocals, sizeof(struct local_state));
+    if (locals == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    /* Segment 0 is never current, so all the locals start out unknown */
+    int seg = 0;
+    for (basicblock *b = entry; b != NULL; b = b->b_next) {
+        int lineno = -1;
+        /* Index of the first instruction after the last observable one */
+        int unobserved = 0;
+        for (int i = 0; i < b->b_iused; i++) {
+            struct instr *inst = &b->b_instr[i];
+            if (i == 0 || inst->i_lineno != lineno) {
+                seg++;
+                lineno = inst->i_lineno;
+                unobserved = i;
+            }
+            struct local_state *x = NULL;
+            if (inst->i_opcode == LOAD_FAST || inst->i_opcode == STORE_FAST ||
+                inst->i_opcode == DELETE_FAST)
+            {
+                assert(inst->i_oparg >= 0 && inst->i_oparg < nlocals);
+                x = &locals[inst->i_oparg];
+            }
+            switch (inst->i_opcode) {
+                case LOAD_FAST:
+                    if (x->const_seg == seg) {
+                        inst->i_opcode = LOAD_CONST;
+                        inst->i_oparg = x->const_index;
+                        break;
+                    }
+                    if (x->bound_seg == seg && i + 1 < b->b_iused &&
+                        b->b_instr[i+1].i_opcode == STORE_FAST &&
+                        b->b_instr[i+1].i_oparg == inst->i_oparg &&
+                        b->b_instr[i+1].i_lineno == lineno)
+                    {
+                        inst->i_opcode = NOP;
+                        b->b_instr[i+1].i_opcode = NOP;
+                        i++;
+                        break;
+                    }
+                    /* The value was read, the last store is not dead */
+                    x->store_seg = 0;
+                    x->bound_seg = seg;
+                    unobserved = i + 1;
+                    break;
+                case STORE_FAST:
+                    if (x->store_seg == seg && x->store_index >= unobserved) {
+                        b->b_instr[x->store_index].i_opcode = POP_TOP;
+                        b->b_instr[x->store_index].i_oparg = 0;
+                    }
+                    x->store_seg = seg;
+                    x->store_index = i;
+                    x->bound_seg = seg;
+                    if (i > 0 && b->b_instr[i-1].i_opcode == LOAD_CONST &&
+                        b->b_instr[i-1].i_lineno == lineno)
+                    {
+                        x->const_seg = seg;
+                        x->const_index = b->b_instr[i-1].i_oparg;
+                    }
+                    else {
+                        x->const_seg = 0;
+                    }
+                    break;
+                case DELETE_FAST:
+                    x->const_seg = x->bound_seg = x->store_seg = 0;
+                    unobserved = i + 1;
+                    break;
+                default:
+                    if (!is_unobservable(inst->i_opcode)) {
+                        unobserved = i + 1;
+                    }
+            }
+        }
+    }
+    PyMem_Free(locals);
+    return 0;
+}
+
 /* Optimization */
 static int
 optimize_basic_block(struct compiler *c, basicblock *bb, PyObject *consts)
@@ -7403,12 +8003,39 @@ mark_reachable(struct assembler *a) {
                 }
                 target->b_predecessors++;
             }
+            target = b->b_instr[i].i_except;
+            if (target != NULL) {
+                if (target->b_predecessors == 0) {
+                    *sp++ = target;
+                }
+                target->b_predecessors++;
+            }
         }
     }
     PyObject_Free(stack);
     return 0;
 }
 
+/* Delete the handlers that no instruction may raise an exception to,
+   once the exception table is known. */
+static int
+eliminate_unused_handlers(struct assembler *a)
+{
+    for (basicblock *b = a->a_entry; b != NULL; b = b->b_next) {
+        b->b_predecessors = 0;
+    }
+    if (mark_reachable(a)) {
+        return -1;
+    }
+    for (basicblock *b = a->a_entry; b != NULL; b = b->b_next) {
+        if (b->b_predecessors == 0) {
+            b->b_iused = 0;
+            b->b_nofallthrough = 0;
+        }
+    }
+    return 0;
+}
+
 static void
 eliminate_empty_basic_blocks(basicblock *entry) {
     /* Eliminate empty blocks */
@@ -7494,6 +8121,9 @@ propogate_line_numbers(struct assembler *a) {
 static int
 optimize_cfg(struct compiler *c, struct assembler *a, PyObject *consts)
 {
+    if (optimize_fast_locals(c, a->a_entry)) {
+        return -1;
+    }
     for (basicblock *b = a->a_entry; b != NULL; b = b->b_next) {
         if (optimize_basic_block(c, b, consts)) {
             return -1;
@@ -2,10 +2,30 @@
 /* Frozen modules initializer */
 
 #include "Python.h"
+#include "pycore_import.h"        // _PyImport_FrozenStdlibModules
 #include "importlib.h"
 #include "importlib_external.h"
 #include "importlib_zipimport.h"
 
+#ifdef Py_FROZEN_STDLIB
+/* Generated from Lib/ at build time: see FROZEN_STDLIB_HEADERS in
+   Makefile.pre.in */
+#include "frozen_modules/abc.h"
+#include "frozen_modules/codecs.h"
+#include "frozen_modules/encodings.h"
+#include "frozen_modules/encodings.aliases.h"
+#include "frozen_modules/encodings.utf_8.h"
+#include "frozen_modules/io.h"
+#include "frozen_modules/_collections_abc.h"
+#include "frozen_modules/_sitebuiltins.h"
+#include "frozen_modules/genericpath.h"
+#include "frozen_modules/ntpath.h"
+#include "frozen_modules/posixpath.h"
+#include "frozen_modules/os.h"
+#include "frozen_modules/site.h"
+#include "frozen_modules/stat.h"
+#endif
+
 /* In order to test the support for frozen modules, by default we
    define a single frozen module, __hello__.  Loading it will print
    some famous words... */
@@ -37,3 +57,36 @@ static const struct _frozen _PyImport_FrozenModules[] = {
    collection of frozen modules: */
 
 const struct _frozen *PyImport_FrozenModules = _PyImport_FrozenModules;
+
+/* The standard library modules imported at startup, frozen when Python is
+   configured --with-frozen-stdlib.  They are not affected by embedding apps
+   changing PyImport_FrozenModules, and "-X frozen_modules=off" disables
+   them. */
+
+#define STDLIB(name, sym) {name, sym, (int)sizeof(sym)}
+#define STDLIB_PACKAGE(name, sym) {name, sym, -(int)sizeof(sym)}
+
+static const struct _frozen _PyImport_FrozenStdlib[] = {
+#ifdef Py_FROZEN_STDLIB
+    STDLIB("abc", _Py_M__abc),
+    STDLIB("codecs", _Py_M__codecs),
+    STDLIB_PACKAGE("encodings", _Py_M__encodings),
+    STDLIB("encodings.aliases", _Py_M__encodingsaliases),
+    STDLIB("encodings.utf_8", _Py_M__encodingsutf_8),
+    STDLIB("io", _Py_M__io),
+    STDLIB("_collections_abc", _Py_M___collections_abc),
+    STDLIB("_sitebuiltins", _Py_M___sitebuiltins),
+    STDLIB("genericpath", _Py_M__genericpath),
+    STDLIB("ntpath", _Py_M__ntpath),
+    STDLIB("posixpath", _Py_M__posixpath),
+    STDLIB("os", _Py_M__os),
+    STDLIB("site", _Py_M__site),
+    STDLIB("stat", _Py_M__stat),
+#endif
+    {0, 0, 0} /* sentinel */
+};
+
+#undef STDLIB
+#undef STDLIB_PACKAGE
+
+const struct _frozen *_PyImport_FrozenStdlibModules = _PyImport_FrozenStdlib;
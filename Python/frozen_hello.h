@@ -8,5 +8,5 @@ const unsigned char _Py_M__hello[] = {
     5,112,114,105,110,116,169,0,114,1,0,0,0,114,1,0,
     0,0,122,14,60,102,114,111,122,101,110,32,104,101,108,108,
     111,62,218,8,60,109,111,100,117,108,101,62,1,0,0,0,
-    115,4,0,0,0,4,0,12,1,
+    115,4,0,0,0,4,0,12,1,243,0,0,0,0,
 };
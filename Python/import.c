@@ -2,6 +2,7 @@
 
 #include "Python.h"
 
+#include "pycore_code.h"          // _PyCode_LoadLazyConst()
 #include "pycore_import.h"        // _PyImport_BootstrapImp()
 #include "pycore_initconfig.h"
 #include "pycore_pyerrors.h"
@@ -836,6 +837,15 @@ update_code_filenames(PyCodeObject *co, PyObject *oldname, PyObject *newname)
     n = PyTuple_GET_SIZE(constants);
     for (i = 0; i < n; i++) {
         tmp = PyTuple_GET_ITEM(constants, i);
+        if (_PyLazyCode_Check(tmp)) {
+            tmp = _PyCode_LoadLazyConst(co, tmp);
+            if (tmp == NULL) {
+                /* Reported again when the code is used */
+                PyErr_Clear();
+                continue;
+            }
+            Py_DECREF(tmp);
+        }
         if (PyCode_Check(tmp))
             update_code_filenames((PyCodeObject *)tmp,
                                   oldname, newname);
@@ -1046,6 +1056,33 @@ _imp_create_builtin(PyObject *module, PyObject *spec)
 
 /* Frozen modules */
 
+static const struct _frozen *
+search_frozen(const struct _frozen *p, PyObject *name)
+{
+    for (; ; p++) {
+        if (p->name == NULL)
+            return NULL;
+        if (_PyUnicode_EqualToASCIIString(name, p->name))
+            break;
+    }
+    return p;
+}
+
+/* Return the frozen standard library module, if enabled */
+static const struct _frozen *
+find_frozen_stdlib(PyObject *name)
+{
+    if (_PyImport_FrozenStdlibModules->name == NULL) {
+        return NULL;
+    }
+    const wchar_t *xopt = _Py_get_xoption(&_Py_GetConfig()->xoptions,
+                                          L"frozen_modules");
+    if (xopt != NULL && wcscmp(xopt, L"frozen_modules=off") == 0) {
+        return NULL;
+    }
+    return search_frozen(_PyImport_FrozenStdlibModules, name);
+}
+
 static const struct _frozen *
 find_frozen(PyObject *name)
 {
@@ -1054,11 +1091,9 @@ find_frozen(PyObject *name)
     if (name == NULL)
         return NULL;
 
-    for (p = PyImport_FrozenModules; ; p++) {
-        if (p->name == NULL)
-            return NULL;
-        if (_PyUnicode_EqualToASCIIString(name, p->name))
-            break;
+    p = search_frozen(PyImport_FrozenModules, name);
+    if (p == NULL) {
+        p = find_frozen_stdlib(name);
     }
     return p;
 }
@@ -1916,6 +1951,26 @@ _imp_is_frozen_package_impl(PyObject *module, PyObject *name)
     return is_frozen_package(name);
 }
 
+/*[clinic input]
+_imp._is_frozen_stdlib
+
+    name: unicode
+    /
+
+Returns True if the module name is of a frozen standard library module.
+
+The module is then also in the directory sys._stdlib_dir.
+[clinic start generated code]*/
+
+static PyObject *
+_imp__is_frozen_stdlib_impl(PyObject *module, PyObject *name)
+/*[clinic end generated code: output=5325179ca60ec7ca input=16d59c145fea6240]*/
+{
+    int res = (search_frozen(PyImport_FrozenModules, name) == NULL
+               && find_frozen_stdlib(name) != NULL);
+    return PyBool_FromLong(res);
+}
+
 /*[clinic input]
 _imp.is_builtin
 
@@ -2111,6 +2166,7 @@ static PyMethodDef imp_methods[] = {
     _IMP_INIT_FROZEN_METHODDEF
     _IMP_IS_BUILTIN_METHODDEF
     _IMP_IS_FROZEN_METHODDEF
+    _IMP__IS_FROZEN_STDLIB_METHODDEF
     _IMP_CREATE_DYNAMIC_METHODDEF
     _IMP_EXEC_DYNAMIC_METHODDEF
     _IMP_EXEC_BUILTIN_METHODDEF
@@ -95,6 +95,10 @@ static const char usage_3[] = "\
          -X pycache_prefix=PATH: enable writing .pyc files to a parallel tree rooted at the\n\
              given directory instead of to the code tree\n\
          -X warn_default_encoding: enable opt-in EncodingWarning for 'encoding=None'\n\
+         -X frozen_modules=off: import the standard library modules from the file\n\
+             system even if they were frozen with --with-frozen-stdlib\n\
+         -X import_index: keep an index of the modules of each sys.path directory in\n\
+             its __pycache__ directory; also PYTHONIMPORTINDEX\n\
 \n\
 --check-hash-based-pycs always|default|never:\n\
     control how Python invalidates hash-based .pyc files\n\
@@ -113,6 +117,7 @@ static const char usage_5[] =
 "               The default module search path uses %s.\n"
 "PYTHONPLATLIBDIR : override sys.platlibdir.\n"
 "PYTHONCASEOK : ignore case in 'import' statements (Windows).\n"
+"PYTHONIMPORTINDEX: use on-disk indexes of the sys.path directories.\n"
 "PYTHONUTF8: if set to 1, enable the UTF-8 mode.\n"
 "PYTHONIOENCODING: Encoding[:errors] used for stdin/stdout/stderr.\n"
 "PYTHONFAULTHANDLER: dump the Python traceback on fatal errors.\n";
@@ -4,7 +4,8 @@
    even though dicts, lists, sets and frozensets, not commonly seen in
    code objects, are supported.
    Version 3 of this protocol properly supports circular links
-   and sharing. */
+   and sharing.  Version 5 writes the code objects nested in other code
+   objects so that they can be loaded on first use (see TYPE_LAZY_CODE). */
 
 #define PY_SSIZE_T_CLEAN
 
@@ -12,6 +13,7 @@
 #include "longintrepr.h"
 #include "code.h"
 #include "marshal.h"
+#include "pycore_code.h"          // _PyLazyCode_Check()
 #include "pycore_hashtable.h"
 
 /*[clinic input]
@@ -71,6 +73,19 @@ module marshal
 #define TYPE_SMALL_TUPLE        ')'
 #define TYPE_SHORT_ASCII        'z'
 #define TYPE_SHORT_ASCII_INTERNED 'Z'
+/* A code object nested in another one, written as its size followed by an
+   independent marshal stream (with its own references), so that loads()
+   can defer reading it until the code is used. */
+#define TYPE_LAZY_CODE          'L'
+
+/* The code object written as TYPE_LAZY_CODE at offset of data */
+typedef struct {
+    PyObject_HEAD
+    PyObject *lc_data;      /* bytes object */
+    Py_ssize_t lc_offset;
+    Py_ssize_t lc_size;
+    PyObject *lc_code;      /* the code object once read, or NULL */
+} PyLazyCodeObject;
 
 #define WFERR_OK 0
 #define WFERR_UNMARSHALLABLE 1
@@ -87,6 +102,7 @@ typedef struct {
     char *buf;
     _Py_hashtable_t *hashtable;
     int version;
+    int consts_depth;  /* depth of the items of the co_consts being written */
 } WFILE;
 
 #define w_byte(c, p) do {                               \
@@ -335,6 +351,38 @@ w_ref(PyObject *v, char *flag, WFILE *p)
 static void
 w_complex_object(PyObject *v, char flag, WFILE *p);
 
+/* Write a nested code object, or a lazy code object, as TYPE_LAZY_CODE. */
+static void
+w_lazy_code(PyObject *v, WFILE *p)
+{
+    PyObject *data;
+    if (_PyLazyCode_Check(v)) {
+        PyLazyCodeObject *lazy = (PyLazyCodeObject *)v;
+        data = PyBytes_FromStringAndSize(
+            PyBytes_AS_STRING(lazy->lc_data) + lazy->lc_offset,
+            lazy->lc_size);
+    }
+    else {
+        data = PyMarshal_WriteObjectToString(v, p->version);
+    }
+    if (data == NULL) {
+        p->error = PyErr_ExceptionMatches(PyExc_MemoryError)
+                   ? WFERR_NOMEMORY : WFERR_UNMARSHALLABLE;
+        PyErr_Clear();
+        return;
+    }
+    Py_ssize_t n = PyBytes_GET_SIZE(data);
+    if (n > INT_MAX) {
+        p->error = WFERR_UNMARSHALLABLE;
+    }
+    else {
+        w_byte(TYPE_LAZY_CODE, p);
+        w_long((long)n, p);
+        w_string(PyBytes_AS_STRING(data), n, p);
+    }
+    Py_DECREF(data);
+}
+
 static void
 w_object(PyObject *v, WFILE *p)
 {
@@ -363,6 +411,25 @@ w_object(PyObject *v, WFILE *p)
     else if (v == Py_True) {
         w_byte(TYPE_TRUE, p);
     }
+    else if (p->version >= 5 && p->depth == p->consts_depth
+             && (PyCode_Check(v) || _PyLazyCode_Check(v))) {
+        w_lazy_code(v, p);
+    }
+    else if (_PyLazyCode_Check(v)) {
+        /* Write the code object itself with older versions */
+        PyObject *code = _PyLazyCode_Load(v);
+        if (code == NULL) {
+            p->error = PyErr_ExceptionMatches(PyExc_MemoryError)
+                       ? WFERR_NOMEMORY : WFERR_UNMARSHALLABLE;
+            PyErr_Clear();
+        }
+        else {
+            p->depth--;
+            w_object(code, p);
+            p->depth++;
+            Py_DECREF(code);
+        }
+    }
     else if (!w_ref(v, &flag, p))
         w_complex_object(v, flag, p);
 
@@ -516,7 +583,10 @@ w_complex_object(PyObject *v, char flag, WFILE *p)
         w_long(co->co_stacksize, p);
         w_long(co->co_flags, p);
         w_object(co->co_code, p);
+        int consts_depth = p->consts_depth;
+        p->consts_depth = p->depth + 2;
         w_object(co->co_consts, p);
+        p->consts_depth = consts_depth;
         w_object(co->co_names, p);
         w_object(co->co_varnames, p);
         w_object(co->co_freevars, p);
@@ -525,6 +595,7 @@ w_complex_object(PyObject *v, char flag, WFILE *p)
         w_object(co->co_name, p);
         w_long(co->co_firstlineno, p);
         w_object(co->co_linetable, p);
+        w_object(co->co_exceptiontable, p);
     }
     else if (PyObject_CheckBuffer(v)) {
         /* Write unknown bytes-like objects as a bytes object */
@@ -618,8 +689,15 @@ typedef struct {
     char *buf;
     Py_ssize_t buf_size;
     PyObject *refs;  /* a list */
+    /* The bytes object being read from by loads(), if any.  Nested code
+       objects are then only read when they are first used. */
+    PyObject *lazy_source;
+    int consts_depth;  /* depth of the items of the co_consts being read */
 } RFILE;
 
+static PyObject *
+read_lazy_code(const char *s, Py_ssize_t n, PyObject *source, int depth);
+
 static const char *
 r_string(Py_ssize_t n, RFILE *p)
 {
@@ -1313,6 +1391,7 @@ r_object(RFILE *p)
             PyObject *name = NULL;
             int firstlineno;
             PyObject *linetable = NULL;
+            PyObject *exceptiontable = NULL;
 
             idx = r_ref_reserve(flag, p);
             if (idx < 0)
@@ -1343,7 +1422,12 @@ r_object(RFILE *p)
             code = r_object(p);
             if (code == NULL)
                 goto code_error;
-            consts = r_object(p);
+            {
+                int consts_depth = p->consts_depth;
+                p->consts_depth = p->depth + 2;
+                consts = r_object(p);
+                p->consts_depth = consts_depth;
+            }
             if (consts == NULL)
                 goto code_error;
             names = r_object(p);
@@ -1370,6 +1454,9 @@ r_object(RFILE *p)
             linetable = r_object(p);
             if (linetable == NULL)
                 goto code_error;
+            exceptiontable = r_object(p);
+            if (exceptiontable == NULL)
+                goto code_error;
 
             if (PySys_Audit("code.__new__", "OOOiiiiii",
                             code, filename, name, argcount, posonlyargcount,
@@ -1377,12 +1464,12 @@ r_object(RFILE *p)
                 goto code_error;
             }
 
-            v = (PyObject *) PyCode_NewWithPosOnlyArgs(
+            v = (PyObject *) _PyCode_NewWithExceptionTable(
                             argcount, posonlyargcount, kwonlyargcount,
                             nlocals, stacksize, flags,
                             code, consts, names, varnames,
                             freevars, cellvars, filename, name,
-                            firstlineno, linetable);
+                            firstlineno, linetable, exceptiontable);
             v = r_ref_insert(v, idx, flag, p);
 
           code_error:
@@ -1395,10 +1482,39 @@ r_object(RFILE *p)
             Py_XDECREF(filename);
             Py_XDECREF(name);
             Py_XDECREF(linetable);
+            Py_XDECREF(exceptiontable);
         }
         retval = v;
         break;
 
+    case TYPE_LAZY_CODE:
+        n = r_long(p);
+        if (n < 0 || n > SIZE32_MAX) {
+            if (!PyErr_Occurred()) {
+                PyErr_SetString(PyExc_ValueError,
+                    "bad marshal data (lazy code size out of range)");
+            }
+            break;
+        }
+        {
+            const char *data = r_string(n, p);
+            if (data == NULL) {
+                break;
+            }
+            if (p->lazy_source != NULL && p->depth == p->consts_depth
+                && data >= PyBytes_AS_STRING(p->lazy_source)
+                && data + n <= (PyBytes_AS_STRING(p->lazy_source)
+                                + PyBytes_GET_SIZE(p->lazy_source))) {
+                retval = _PyLazyCode_New(
+                    p->lazy_source,
+                    data - PyBytes_AS_STRING(p->lazy_source), n);
+            }
+            else {
+                retval = read_lazy_code(data, n, NULL, p->depth);
+            }
+        }
+        break;
+
     case TYPE_REF:
         n = r_long(p);
         if (n < 0 || n >= PyList_GET_SIZE(p->refs)) {
@@ -1528,6 +1644,8 @@ PyMarshal_ReadObjectFromFile(FILE *fp)
     rf.depth = 0;
     rf.ptr = rf.end = NULL;
     rf.buf = NULL;
+    rf.lazy_source = NULL;
+    rf.consts_depth = 0;
     rf.refs = PyList_New(0);
     if (rf.refs == NULL)
         return NULL;
@@ -1549,6 +1667,8 @@ PyMarshal_ReadObjectFromString(const char *str, Py_ssize_t len)
     rf.end = str + len;
     rf.buf = NULL;
     rf.depth = 0;
+    rf.lazy_source = NULL;
+    rf.consts_depth = 0;
     rf.refs = PyList_New(0);
     if (rf.refs == NULL)
         return NULL;
@@ -1559,6 +1679,95 @@ PyMarshal_ReadObjectFromString(const char *str, Py_ssize_t len)
     return result;
 }
 
+/* Read the code object written as TYPE_LAZY_CODE at s.  If source is not
+ * NULL, it is the bytes object containing s, and the code objects nested in
+ * the one read are themselves left to be read lazily. */
+static PyObject *
+read_lazy_code(const char *s, Py_ssize_t n, PyObject *source, int depth)
+{
+    RFILE rf;
+    PyObject *result;
+    rf.fp = NULL;
+    rf.readable = NULL;
+    rf.ptr = s;
+    rf.end = s + n;
+    rf.buf = NULL;
+    rf.depth = depth;
+    rf.lazy_source = source;
+    rf.consts_depth = 0;
+    rf.refs = PyList_New(0);
+    if (rf.refs == NULL)
+        return NULL;
+    result = read_object(&rf);
+    Py_DECREF(rf.refs);
+    if (result != NULL && !PyCode_Check(result)) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_ValueError,
+                        "bad marshal data (lazy code is not a code object)");
+        return NULL;
+    }
+    return result;
+}
+
+PyObject *
+_PyLazyCode_New(PyObject *data, Py_ssize_t offset, Py_ssize_t size)
+{
+    assert(PyBytes_CheckExact(data));
+    assert(offset >= 0 && offset + size <= PyBytes_GET_SIZE(data));
+    PyLazyCodeObject *lazy = PyObject_New(PyLazyCodeObject, &_PyLazyCode_Type);
+    if (lazy == NULL) {
+        return NULL;
+    }
+    Py_INCREF(data);
+    lazy->lc_data = data;
+    lazy->lc_offset = offset;
+    lazy->lc_size = size;
+    lazy->lc_code = NULL;
+    return (PyObject *)lazy;
+}
+
+PyObject *
+_PyLazyCode_Load(PyObject *op)
+{
+    assert(_PyLazyCode_Check(op));
+    PyLazyCodeObject *lazy = (PyLazyCodeObject *)op;
+    if (lazy->lc_code == NULL) {
+        lazy->lc_code = read_lazy_code(
+            PyBytes_AS_STRING(lazy->lc_data) + lazy->lc_offset,
+            lazy->lc_size, lazy->lc_data, 0);
+        if (lazy->lc_code == NULL) {
+            return NULL;
+        }
+    }
+    Py_INCREF(lazy->lc_code);
+    return lazy->lc_code;
+}
+
+static void
+lazycode_dealloc(PyLazyCodeObject *lazy)
+{
+    Py_DECREF(lazy->lc_data);
+    Py_XDECREF(lazy->lc_code);
+    PyObject_Free(lazy);
+}
+
+static PyObject *
+lazycode_repr(PyLazyCodeObject *lazy)
+{
+    return PyUnicode_FromFormat("<lazy code object at %p, %zd bytes>",
+                                lazy, lazy->lc_size);
+}
+
+PyTypeObject _PyLazyCode_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    .tp_name = "lazy_code",
+    .tp_basicsize = sizeof(PyLazyCodeObject),
+    .tp_dealloc = (destructor)lazycode_dealloc,
+    .tp_repr = (reprfunc)lazycode_repr,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "A code object that has not been unmarshalled yet.",
+};
+
 PyObject *
 PyMarshal_WriteObjectToString(PyObject *x, int version)
 {
@@ -1680,6 +1889,8 @@ marshal_load(PyObject *module, PyObject *file)
         rf.readable = file;
         rf.ptr = rf.end = NULL;
         rf.buf = NULL;
+        rf.lazy_source = NULL;
+        rf.consts_depth = 0;
         if ((rf.refs = PyList_New(0)) != NULL) {
             result = read_object(&rf);
             Py_DECREF(rf.refs);
@@ -1739,6 +1950,18 @@ marshal_loads_impl(PyObject *module, Py_buffer *bytes)
     rf.ptr = s;
     rf.end = s + n;
     rf.depth = 0;
+    /* The code objects nested in the one read from an immutable bytes
+       object, such as the contents of a .pyc file, can be read on demand */
+    rf.lazy_source = NULL;
+    rf.consts_depth = 0;
+    if (PyBytes_CheckExact(bytes->obj)) {
+        rf.lazy_source = bytes->obj;
+    }
+    else if (PyMemoryView_Check(bytes->obj)
+             && PyMemoryView_GET_BASE(bytes->obj) != NULL
+             && PyBytes_CheckExact(PyMemoryView_GET_BASE(bytes->obj))) {
+        rf.lazy_source = PyMemoryView_GET_BASE(bytes->obj);
+    }
     if ((rf.refs = PyList_New(0)) == NULL)
         return NULL;
     result = read_object(&rf);
@@ -57,6 +57,7 @@ pathconfig_clear(_PyPathConfig *config)
     CLEAR(config->module_search_path);
     CLEAR(config->program_name);
     CLEAR(config->home);
+    CLEAR(config->stdlib_dir);
 #ifdef MS_WINDOWS
     CLEAR(config->base_executable);
 #endif
@@ -85,6 +86,7 @@ pathconfig_copy(_PyPathConfig *config, const _PyPathConfig *config2)
     COPY_ATTR(module_search_path);
     COPY_ATTR(program_name);
     COPY_ATTR(home);
+    COPY_ATTR(stdlib_dir);
 #ifdef MS_WINDOWS
     config->isolated = config2->isolated;
     config->site_import = config2->site_import;
@@ -404,6 +406,18 @@ config_init_pathconfig(PyConfig *config, int compute_path_config)
 
 #undef COPY_ATTR
 
+    /* PyConfig has no stdlib_dir: keep it in the global configuration */
+    if (pathconfig.stdlib_dir != NULL) {
+        PyMemAllocatorEx old_alloc;
+        _PyMem_SetDefaultAllocator(PYMEM_DOMAIN_RAW, &old_alloc);
+        PyMem_RawFree(_Py_path_config.stdlib_dir);
+        _Py_path_config.stdlib_dir = _PyMem_RawWcsdup(pathconfig.stdlib_dir);
+        PyMem_SetAllocator(PYMEM_DOMAIN_RAW, &old_alloc);
+        if (_Py_path_config.stdlib_dir == NULL) {
+            goto no_memory;
+        }
+    }
+
 #ifdef MS_WINDOWS
     /* If a ._pth file is found: isolated and site_import are overriden */
     if (pathconfig.isolated != -1) {
@@ -1973,6 +1973,57 @@ sys__deactivate_opcache_impl(PyObject *module)
 }
 
 
+/*[clinic input]
+sys._set_opcache_stats
+
+    enable: bool
+    /
+
+Enable or disable collecting opcode cache statistics.
+
+Counters are kept both globally and per code object; see
+sys._opcache_stats().
+[clinic start generated code]*/
+
+static PyObject *
+sys__set_opcache_stats_impl(PyObject *module, int enable)
+/*[clinic end generated code: output=0186106633eff297 input=725b8ea7131e3167]*/
+{
+    _PyEval_SetOpcacheStats(enable);
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+sys._opcache_stats
+
+    code: object = None
+    /
+
+Return opcode cache statistics collected since sys._set_opcache_stats(True).
+
+The result maps each cached opcode name to a dict of its "opts", "hits",
+"misses" and "deopts" counters.  Without argument, return the totals for
+all code objects; otherwise return the counters of the given code object.
+[clinic start generated code]*/
+
+static PyObject *
+sys__opcache_stats_impl(PyObject *module, PyObject *code)
+/*[clinic end generated code: output=e46ea3986f0c32ce input=57bc7888c769bc6f]*/
+{
+    if (code == Py_None) {
+        return _PyEval_GetOpcacheStats(NULL);
+    }
+    if (!PyCode_Check(code)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a code object, not %.200s",
+                     Py_TYPE(code)->tp_name);
+        return NULL;
+    }
+    return _PyEval_GetOpcacheStats((PyCodeObject *)code);
+}
+
+
 static PyMethodDef sys_methods[] = {
     /* Might as well keep this in alphabetic order */
     SYS_ADDAUDITHOOK_METHODDEF
@@ -2026,6 +2077,8 @@ static PyMethodDef sys_methods[] = {
     SYS_GETANDROIDAPILEVEL_METHODDEF
     SYS_UNRAISABLEHOOK_METHODDEF
     SYS__DEACTIVATE_OPCACHE_METHODDEF
+    SYS__SET_OPCACHE_STATS_METHODDEF
+    SYS__OPCACHE_STATS_METHODDEF
     {NULL,              NULL}           /* sentinel */
 };
 
@@ -2983,6 +3036,11 @@ _PySys_UpdateConfig(PyThreadState *tstate)
     COPY_WSTR("exec_prefix", config->exec_prefix);
     COPY_WSTR("base_exec_prefix", config->base_exec_prefix);
     COPY_WSTR("platlibdir", config->platlibdir);
+    if (_Py_path_config.stdlib_dir != NULL) {
+        SET_SYS_FROM_WSTR("_stdlib_dir", _Py_path_config.stdlib_dir);
+    } else {
+        PyDict_SetItemString(sysdict, "_stdlib_dir", Py_None);
+    }
 
     if (config->pycache_prefix != NULL) {
         SET_SYS_FROM_WSTR("pycache_prefix", config->pycache_prefix);
@@ -76,6 +76,16 @@ def pi_digits():
 
     return calc_ndigits, (50, )
 
+def task_allocation():
+    """small object allocation (Python)"""
+    def allocate(n):
+        # Build and drop many small containers: mostly pymalloc traffic.
+        objs = [(i, [i], {'i': i}) for i in xrange(n)]
+        del objs[::2]
+        return len(objs)
+
+    return allocate, (200, )
+
 def task_regex():
     """regular expression (C)"""
     # XXX this task gives horrendous latency results.
@@ -125,7 +135,7 @@ def compute(s):
     return compute, (arg, )
 
 
-throughput_tasks = [task_pidigits, task_regex]
+throughput_tasks = [task_pidigits, task_allocation, task_regex]
 for mod in 'bz2', 'hashlib':
     try:
         globals()[mod] = __import__(mod)
@@ -0,0 +1,78 @@
+"""Benchmark full garbage collections against the number of threads.
+
+Build a heap of tracked containers, then time gc.collect() for each number
+of threads given to gc.set_parallel(), from 1 up to the number of CPUs.
+"""
+
+import argparse
+import gc
+import os
+import time
+
+
+class Node:
+    pass
+
+
+def build_heap(nobjects, garbage):
+    """Return a list of about nobjects live containers, and leave garbage
+    cycles of about as many objects behind, in proportion 'garbage'."""
+    heap = []
+    for i in range(nobjects // 3):
+        node = Node()
+        node.items = [i, (i, str(i))]
+        heap.append(node)
+    for i in range(int(nobjects * garbage) // 3):
+        node = Node()
+        node.cycle = [node]
+    return heap
+
+
+def bench(nthreads, nobjects, garbage, repeat):
+    gc.set_parallel(nthreads)
+    best = None
+    for i in range(repeat):
+        heap = build_heap(nobjects, garbage)
+        start = time.perf_counter()
+        gc.collect()
+        elapsed = time.perf_counter() - start
+        if best is None or elapsed < best:
+            best = elapsed
+        del heap
+        gc.set_parallel(1)
+        gc.collect()
+        gc.set_parallel(nthreads)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("-n", "--objects", type=int, default=3_000_000,
+                        help="number of live containers (default: %(default)s)")
+    parser.add_argument("-g", "--garbage", type=float, default=0.1,
+                        help="garbage created per live container "
+                             "(default: %(default)s)")
+    parser.add_argument("-j", "--threads", type=int, default=os.cpu_count(),
+                        help="maximum number of threads (default: number of CPUs)")
+    parser.add_argument("-r", "--repeat", type=int, default=3,
+                        help="number of timings for each number of threads, "
+                             "the best is kept (default: %(default)s)")
+    args = parser.parse_args()
+
+    gc.disable()
+    print(f"{args.objects:,} containers, {args.garbage:.0%} garbage")
+    print("threads   time (ms)   speedup")
+    baseline = None
+    nthreads = 1
+    while True:
+        elapsed = bench(nthreads, args.objects, args.garbage, args.repeat)
+        if baseline is None:
+            baseline = elapsed
+        print(f"{nthreads:7}   {elapsed * 1e3:9.1f}   {baseline / elapsed:7.2f}")
+        if nthreads >= args.threads:
+            break
+        nthreads = min(nthreads * 2, args.threads)
+
+
+if __name__ == "__main__":
+    main()
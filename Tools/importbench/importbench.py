@@ -4,6 +4,7 @@
 thus has no external changes made to import-related attributes in sys.
 
 """
+from test.support import swap_item
 from test.test_importlib import util
 import decimal
 import imp
@@ -14,6 +15,7 @@
 import py_compile
 import sys
 import tabnanny
+import tempfile
 import timeit
 
 
@@ -162,6 +164,55 @@ def using_bytecode_benchmark(seconds, repeat):
 decimal_using_bytecode = _using_bytecode(decimal)
 
 
+def _long_sys_path(use_index):
+    def long_sys_path_benchmark(seconds, repeat):
+        """Long sys.path, cold finders: {}"""
+        name = '__importlib_test_benchmark__'
+        with tempfile.TemporaryDirectory() as root:
+            path = []
+            for i in range(50):
+                directory = os.path.join(root, str(i))
+                os.mkdir(directory)
+                os.mkdir(os.path.join(directory, '__pycache__'))
+                for j in range(200):
+                    filename = 'mod{}.py'.format(j)
+                    with open(os.path.join(directory, filename), 'w'):
+                        pass
+                path.append(directory)
+            filename = os.path.join(path[-1], name + '.py')
+            with open(filename, 'w'):
+                pass
+            py_compile.compile(filename)
+            for directory in path:
+                # Recently modified directories are not indexed.
+                os.utime(directory, (0, 0))
+            hook = importlib.machinery.FileFinder.path_hook(
+                (importlib.machinery.ExtensionFileLoader,
+                 importlib.machinery.EXTENSION_SUFFIXES),
+                (importlib.machinery.SourceFileLoader,
+                 importlib.machinery.SOURCE_SUFFIXES),
+                (importlib.machinery.SourcelessFileLoader,
+                 importlib.machinery.BYTECODE_SUFFIXES))
+            def cleanup():
+                sys.modules.pop(name)
+                sys.path_importer_cache.clear()
+            with util.import_state(meta_path=[importlib.machinery.PathFinder],
+                                   path=path, path_hooks=[hook]), \
+                 swap_item(sys._xoptions, 'import_index', use_index), \
+                 swap_item(sys.__dict__, 'dont_write_bytecode', False):
+                if not use_index:
+                    del sys._xoptions['import_index']
+                yield from bench(name, cleanup, repeat=repeat,
+                                 seconds=seconds)
+
+    long_sys_path_benchmark.__doc__ = long_sys_path_benchmark.__doc__.format(
+                                'w/ index' if use_index else 'w/o index')
+    return long_sys_path_benchmark
+
+long_sys_path_wo_index = _long_sys_path(False)
+long_sys_path_using_index = _long_sys_path(True)
+
+
 def main(import_, options):
     if options.source_file:
         with options.source_file:
@@ -176,6 +227,7 @@ def main(import_, options):
                   tabnanny_wo_bytecode, tabnanny_using_bytecode,
                   decimal_writing_bytecode,
                   decimal_wo_bytecode, decimal_using_bytecode,
+                  long_sys_path_wo_index, long_sys_path_using_index,
                 )
     if options.benchmark:
         for b in benchmarks:
@@ -74,10 +74,13 @@ def report_status(
             print(f"  {str(error.__class__.__name__)}: {error}")
 
 
-def parse_file(source: str, file: str) -> Tuple[Any, float]:
-    t0 = time.time()
-    result = ast.parse(source, filename=file)
-    t1 = time.time()
+def parse_file(source: str, file: str, mode: int = PARSE) -> Tuple[Any, float]:
+    t0 = time.perf_counter()
+    if mode == COMPILE:
+        result = compile(source, file, "exec")
+    else:
+        result = ast.parse(source, filename=file)
+    t1 = time.perf_counter()
     return result, t1 - t0
 
 
@@ -102,7 +105,9 @@ def generate_time_stats(files, total_seconds) -> None:
         )
 
 
-def parse_directory(directory: str, verbose: bool, excluded_files: List[str], short: bool) -> int:
+def parse_directory(
+    directory: str, verbose: bool, excluded_files: List[str], short: bool, mode: int = PARSE
+) -> int:
     # For a given directory, traverse files and attempt to parse each one
     # - Output success/failure for each file
     errors = 0
@@ -118,7 +123,7 @@ def parse_directory(directory: str, verbose: bool, excluded_files: List[str], sh
             source = f.read()
 
         try:
-            result, dt = parse_file(source, file)
+            result, dt = parse_file(source, file, mode)
             total_seconds += dt
             report_status(succeeded=True, file=file, verbose=verbose, short=short)
         except SyntaxError as error:
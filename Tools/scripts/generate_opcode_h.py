@@ -32,6 +32,13 @@
 
 UINT32_MASK = (1<<32)-1
 
+def superinstruction_opmap(opcode):
+    # Superinstructions take the unused opcodes following HAVE_ARGUMENT,
+    # since they all carry the argument of their first instruction.
+    used = set(opcode['opmap'].values())
+    free = (op for op in range(opcode['HAVE_ARGUMENT'], 256) if op not in used)
+    return dict(zip(opcode['_superinstructions'], free))
+
 def write_int_array_from_ops(name, ops, out):
     bits = 0
     for op in ops:
@@ -63,6 +70,9 @@ def main(opcode_py, outfile='Include/opcode.h'):
             if name == 'POP_EXCEPT': # Special entry for HAVE_ARGUMENT
                 fobj.write("#define %-23s %3d\n" %
                             ('HAVE_ARGUMENT', opcode['HAVE_ARGUMENT']))
+        fobj.write("\n    /* Superinstructions, only found in quickened code */\n")
+        for name, op in superinstruction_opmap(opcode).items():
+            fobj.write("#define %-23s %3s\n" % (name, op))
         fobj.write("#ifdef NEED_OPCODE_JUMP_TABLES\n")
         write_int_array_from_ops("_PyOpcode_RelativeJump", opcode['hasjrel'], fobj)
         write_int_array_from_ops("_PyOpcode_Jump", opcode['hasjrel'] + opcode['hasjabs'], fobj)